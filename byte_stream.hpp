@@ -0,0 +1,767 @@
+#pragma once
+
+/**
+ * @file byte_stream.hpp
+ * @brief Cursor baca/tulis atas buffer byte dengan konversi endian
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - byte_reader: cursor read-only atas std::span<const uint8_t>
+ * - byte_writer: cursor write atas std::span<uint8_t>
+ * - record_reader / record_writer: akses tanpa bounds check atas satu record
+ *   yang sudah divalidasi sekali lewat take(n)
+ * - stream_reader<Refill>: byte_reader di atas buffer yang diisi ulang lewat
+ *   callback (file, socket, dll.)
+ * - Varint LEB128 (unsigned: ULEB128, signed: SLEB128)
+ *
+ * Setiap field dibaca/ditulis dengan load_le / load_be / store_le / store_be
+ * (satu unaligned load/store + bswap bila perlu). Error bersifat sticky:
+ * read/write di luar buffer menandai stream gagal, read berikutnya
+ * menghasilkan T{} dan write berikutnya diabaikan, sehingga cukup cek
+ * ok() sekali di akhir record.
+ */
+
+#include "bytes.hpp"
+#include "endian.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+namespace detail {
+
+/** @brief Panjang maksimum LEB128 untuk T */
+template <typename T>
+inline constexpr size_t varint_max_bytes = (sizeof(T) * 8 + 6) / 7;
+
+/** @brief Integer yang bisa di-encode sebagai varint */
+template <typename T>
+concept varint_integer = std::integral<T> && !std::same_as<T, bool>;
+
+/**
+ * @brief Gabungkan 7-bit payload dari 8 byte LEB128 (bit kontinuasi diabaikan)
+ * @note pext bila BMI2, selain itu 3 langkah shift-mask
+ */
+[[nodiscard]] inline uint64_t varint_gather(uint64_t w) noexcept {
+#if defined(__BMI2__) && defined(ZUU_ENDIAN_SSE2)
+    return _pext_u64(w, 0x7F7F7F7F7F7F7F7Full);
+#else
+    w = ((w & 0x7F007F007F007F00ull) >> 1) | (w & 0x007F007F007F007Full);
+    w = ((w & 0x3FFF00003FFF0000ull) >> 2) | (w & 0x00003FFF00003FFFull);
+    return ((w & 0x0FFFFFFF00000000ull) >> 4) | (w & 0x000000000FFFFFFFull);
+#endif
+}
+
+/**
+ * @brief Decode LEB128 dari [p, end) ke T
+ * @return Jumlah byte yang dikonsumsi, 0 jika terpotong, terlalu panjang atau overflow
+ *
+ * Jika tersedia >= 8 byte dan varint <= 8 byte, panjang dan nilai didapat dari
+ * satu load 8-byte tanpa loop; selain itu loop per byte (tanpa cek end bila
+ * tersedia >= varint_max_bytes<T> byte).
+ */
+template <varint_integer T>
+[[nodiscard]] inline size_t decode_varint(const uint8_t* p, const uint8_t* end, T& out) noexcept {
+    using U = std::make_unsigned_t<T>;
+    constexpr size_t max_bytes = varint_max_bytes<T>;
+    constexpr unsigned bits = sizeof(T) * 8;
+
+    const size_t avail = static_cast<size_t>(end - p);
+    const size_t limit = avail < max_bytes ? avail : max_bytes;
+    uint64_t v = 0;
+    size_t i = 0;
+    uint8_t b = 0;
+    const uint64_t x = avail >= 8 ? load_le<uint64_t>(p) : 0;
+    const uint64_t stop = ~x & 0x8080808080808080ull;
+    if (avail >= 8 && stop) {
+        // Panjang <= 8: byte terakhir dicari lewat ctz, tanpa branch per byte
+        i = static_cast<size_t>(std::countr_zero(stop) >> 3) + 1;
+        if (i > max_bytes) return 0;
+        const uint64_t w = x & (stop ^ (stop - 1));
+        b = static_cast<uint8_t>(w >> (8 * (i - 1)));
+        v = varint_gather(w);
+    } else if (limit == max_bytes) {
+        // Fast path: tidak perlu cek end per byte
+        do {
+            b = p[i];
+            v |= static_cast<uint64_t>(b & 0x7F) << (7 * i);
+            ++i;
+        } while ((b & 0x80) && i < max_bytes);
+    } else {
+        do {
+            if (i == limit) return 0;
+            b = p[i];
+            v |= static_cast<uint64_t>(b & 0x7F) << (7 * i);
+            ++i;
+        } while (b & 0x80);
+    }
+    if (b & 0x80) return 0;  // lebih panjang dari max_bytes
+
+    const unsigned shift = static_cast<unsigned>(7 * i);
+    if constexpr (std::is_unsigned_v<T>) {
+        // Bit di atas lebar T harus nol
+        if (shift > bits && (b >> (bits - 7 * (i - 1))) != 0) return 0;
+        out = static_cast<T>(v);
+    } else {
+        // Sign-extend dari bit ke-shift, lalu bit di atas lebar T harus salinan sign
+        if (shift < 64 && (b & 0x40)) v |= ~uint64_t{0} << shift;
+        if (shift > bits) {
+            const unsigned used = bits - 7 * static_cast<unsigned>(i - 1);  // bit payload terakhir yang masuk T
+            const uint8_t sign = (b >> (used - 1)) & 1;
+            const uint8_t high = static_cast<uint8_t>((b & 0x7F) >> used);
+            if (high != (sign ? (0x7F >> used) : 0)) return 0;
+        }
+        if constexpr (sizeof(T) < 8) {
+            const auto sv = static_cast<int64_t>(v);
+            if (sv < std::numeric_limits<T>::min() || sv > std::numeric_limits<T>::max()) return 0;
+        }
+        out = static_cast<T>(static_cast<U>(v));
+    }
+    return i;
+}
+
+/** @brief Jumlah byte LEB128 untuk v */
+template <varint_integer T>
+[[nodiscard]] constexpr size_t varint_size(T v) noexcept {
+    size_t n = 1;
+    if constexpr (std::is_unsigned_v<T>) {
+        for (uint64_t u = v; u >= 0x80; u >>= 7) ++n;
+    } else {
+        for (int64_t x = v; x < -64 || x > 63; x >>= 7) ++n;
+    }
+    return n;
+}
+
+/** @brief Encode v sebagai LEB128 ke dst (minimal varint_size(v) byte) */
+template <varint_integer T>
+inline size_t encode_varint(uint8_t* dst, T v) noexcept {
+    size_t n = 0;
+    if constexpr (std::is_unsigned_v<T>) {
+        uint64_t u = v;
+        while (u >= 0x80) {
+            dst[n++] = static_cast<uint8_t>(u | 0x80);
+            u >>= 7;
+        }
+        dst[n++] = static_cast<uint8_t>(u);
+    } else {
+        int64_t x = v;
+        while (x < -64 || x > 63) {
+            dst[n++] = static_cast<uint8_t>((x & 0x7F) | 0x80);
+            x >>= 7;
+        }
+        dst[n++] = static_cast<uint8_t>(x & 0x7F);
+    }
+    return n;
+}
+
+} // namespace detail
+
+// ============= Record Access =============
+
+/**
+ * @brief Cursor read tanpa bounds check atas satu record yang sudah divalidasi
+ *
+ * Didapat dari byte_reader::take(n): ukuran record dicek sekali, lalu setiap
+ * field dibaca langsung. Membaca melebihi n byte adalah UB.
+ *
+ * @example
+ * ```cpp
+ * if (auto rec = r.take(14)) {
+ *     auto id  = rec.read_be<uint32_t>();
+ *     auto len = rec.read_be<uint16_t>();
+ *     auto ts  = rec.read_le<double>();
+ * }
+ * ```
+ */
+class record_reader {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+
+private:
+    const byte_t* pos_ = nullptr;
+    const byte_t* end_ = nullptr;
+    bool valid_ = false;
+
+public:
+    constexpr record_reader() noexcept = default;
+    constexpr record_reader(const byte_t* data, size_type size) noexcept
+        : pos_(data), end_(data + size), valid_(true) {}
+
+    /** @brief False jika take() gagal (buffer tidak cukup) */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid_; }
+
+    [[nodiscard]] constexpr size_type remaining() const noexcept { return static_cast<size_type>(end_ - pos_); }
+    [[nodiscard]] constexpr const byte_t* current() const noexcept { return pos_; }
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_le() noexcept {
+        const T v = load_le<T>(pos_);
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_be() noexcept {
+        const T v = load_be<T>(pos_);
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read(endian_t order) noexcept {
+        return order == endian_t::big ? read_be<T>() : read_le<T>();
+    }
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    [[nodiscard]] T read_raw() noexcept {
+        T v;
+        std::memcpy(&v, pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    /** @brief Baca field bytes<N> */
+    template <size_t N>
+    [[nodiscard]] bytes<N> read_bytes() noexcept {
+        bytes<N> b;
+        std::memcpy(b.data(), pos_, N);
+        pos_ += N;
+        return b;
+    }
+
+    [[nodiscard]] std::span<const byte_t> read_bytes(size_type n) noexcept {
+        const byte_t* p = pos_;
+        pos_ += n;
+        return { p, n };
+    }
+
+    void skip(size_type n) noexcept { pos_ += n; }
+};
+
+/**
+ * @brief Cursor write tanpa bounds check atas satu record yang sudah dicadangkan
+ * @note Didapat dari byte_writer::take(n); menulis melebihi n byte adalah UB
+ */
+class record_writer {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+
+private:
+    byte_t* pos_ = nullptr;
+    byte_t* end_ = nullptr;
+    bool valid_ = false;
+
+public:
+    constexpr record_writer() noexcept = default;
+    constexpr record_writer(byte_t* data, size_type size) noexcept
+        : pos_(data), end_(data + size), valid_(true) {}
+
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return valid_; }
+
+    [[nodiscard]] constexpr size_type remaining() const noexcept { return static_cast<size_type>(end_ - pos_); }
+    [[nodiscard]] constexpr byte_t* current() const noexcept { return pos_; }
+
+    template <detail::byte_swap_scalar T>
+    void write_le(std::type_identity_t<T> v) noexcept {
+        store_le<T>(pos_, v);
+        pos_ += sizeof(T);
+    }
+
+    template <detail::byte_swap_scalar T>
+    void write_be(std::type_identity_t<T> v) noexcept {
+        store_be<T>(pos_, v);
+        pos_ += sizeof(T);
+    }
+
+    template <detail::byte_swap_scalar T>
+    void write(std::type_identity_t<T> v, endian_t order) noexcept {
+        if (order == endian_t::big) write_be<T>(v);
+        else write_le<T>(v);
+    }
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    void write_raw(const T& v) noexcept {
+        std::memcpy(pos_, &v, sizeof(T));
+        pos_ += sizeof(T);
+    }
+
+    void write_bytes(std::span<const byte_t> src) noexcept {
+        if (!src.empty()) std::memcpy(pos_, src.data(), src.size());
+        pos_ += src.size();
+    }
+
+    void fill(size_type n, byte_t value = 0) noexcept {
+        std::memset(pos_, value, n);
+        pos_ += n;
+    }
+};
+
+// ============= Reader =============
+
+/**
+ * @brief Cursor read-only atas buffer byte
+ * @example
+ * ```cpp
+ * byte_reader r(packet);
+ * auto magic = r.read_be<uint32_t>();
+ * auto len   = r.read_le<uint16_t>();
+ * auto body  = r.read_bytes(len);       // zero-copy
+ * if (!r) return error;                 // satu cek untuk semua field
+ * ```
+ */
+class byte_reader {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+
+private:
+    const byte_t* begin_ = nullptr;
+    const byte_t* pos_ = nullptr;
+    const byte_t* end_ = nullptr;
+    bool ok_ = true;
+
+    /** @brief Cek n byte tersedia; jika tidak tandai gagal dan habiskan buffer */
+    [[nodiscard]] bool require(size_type n) noexcept {
+        if (static_cast<size_type>(end_ - pos_) >= n) [[likely]] return true;
+        ok_ = false;
+        pos_ = end_;
+        return false;
+    }
+
+public:
+    constexpr byte_reader() noexcept = default;
+    constexpr explicit byte_reader(std::span<const byte_t> buffer) noexcept
+        : begin_(buffer.data()), pos_(buffer.data()), end_(buffer.data() + buffer.size()) {}
+
+    // ============= State =============
+
+    /** @brief False jika pernah ada read di luar buffer */
+    [[nodiscard]] constexpr bool ok() const noexcept { return ok_; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return ok_; }
+
+    /** @brief Tandai stream gagal (mis. validasi field gagal) */
+    constexpr void fail() noexcept { ok_ = false; pos_ = end_; }
+
+    [[nodiscard]] constexpr size_type position() const noexcept { return static_cast<size_type>(pos_ - begin_); }
+    [[nodiscard]] constexpr size_type remaining() const noexcept { return static_cast<size_type>(end_ - pos_); }
+    [[nodiscard]] constexpr size_type size() const noexcept { return static_cast<size_type>(end_ - begin_); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return pos_ == end_; }
+
+    /** @brief Pointer ke byte berikutnya */
+    [[nodiscard]] constexpr const byte_t* current() const noexcept { return pos_; }
+
+    /** @brief Sisa buffer yang belum dibaca */
+    [[nodiscard]] constexpr std::span<const byte_t> rest() const noexcept { return { pos_, remaining() }; }
+
+    // ============= Read =============
+
+    /** @brief Baca T little-endian; T{} jika buffer habis */
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_le() noexcept {
+        if (!require(sizeof(T))) return T{};
+        const T v = load_le<T>(pos_);
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    /** @brief Baca T big-endian; T{} jika buffer habis */
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_be() noexcept {
+        if (!require(sizeof(T))) return T{};
+        const T v = load_be<T>(pos_);
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    /** @brief Baca T dengan byte order runtime */
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read(endian_t order) noexcept {
+        return order == endian_t::big ? read_be<T>() : read_le<T>();
+    }
+
+    /** @brief Baca sizeof(T) byte apa adanya (layout native, tanpa konversi) */
+    template <typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    [[nodiscard]] T read_raw() noexcept {
+        T v{};
+        if (!require(sizeof(T))) return v;
+        std::memcpy(&v, pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return v;
+    }
+
+    /** @brief Ambil n byte berikutnya tanpa copy; span kosong jika buffer habis */
+    [[nodiscard]] std::span<const byte_t> read_bytes(size_type n) noexcept {
+        if (!require(n)) return {};
+        const byte_t* p = pos_;
+        pos_ += n;
+        return { p, n };
+    }
+
+    /** @brief Copy dst.size() byte ke dst */
+    bool read_into(std::span<byte_t> dst) noexcept {
+        if (!require(dst.size())) return false;
+        if (!dst.empty()) std::memcpy(dst.data(), pos_, dst.size());
+        pos_ += dst.size();
+        return true;
+    }
+
+    /** @brief Lewati n byte */
+    bool skip(size_type n) noexcept {
+        if (!require(n)) return false;
+        pos_ += n;
+        return true;
+    }
+
+    /** @brief Baca field bytes<N> (zero jika buffer habis) */
+    template <size_t N>
+    [[nodiscard]] bytes<N> read_bytes() noexcept {
+        bytes<N> b;
+        if (!require(N)) return b;
+        std::memcpy(b.data(), pos_, N);
+        pos_ += N;
+        return b;
+    }
+
+    /**
+     * @brief Baca varint LEB128 (ULEB128 untuk unsigned, SLEB128 untuk signed)
+     * @note Terpotong, lebih panjang dari varint_max_bytes<T> atau overflow T
+     *       menandai stream gagal dan menghasilkan T{}
+     */
+    template <detail::varint_integer T>
+    [[nodiscard]] T read_varint() noexcept {
+        T v{};
+        const size_t n = detail::decode_varint(pos_, end_, v);
+        if (n == 0) [[unlikely]] {
+            fail();
+            return T{};
+        }
+        pos_ += n;
+        return v;
+    }
+
+    // ============= Batched =============
+
+    /**
+     * @brief Ambil n byte sebagai record_reader dengan satu bounds check
+     * @return record_reader kosong (false) dan stream gagal jika buffer kurang
+     */
+    [[nodiscard]] record_reader take(size_type n) noexcept {
+        if (!require(n)) return {};
+        const byte_t* p = pos_;
+        pos_ += n;
+        return { p, n };
+    }
+};
+
+// ============= Writer =============
+
+/**
+ * @brief Cursor write atas buffer byte
+ * @example
+ * ```cpp
+ * uint8_t buf[64];
+ * byte_writer w(buf);
+ * w.write_be<uint32_t>(magic);
+ * w.write_le<uint16_t>(len);
+ * w.write_bytes(body);
+ * if (w) send(w.written());
+ * ```
+ */
+class byte_writer {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+
+private:
+    byte_t* begin_ = nullptr;
+    byte_t* pos_ = nullptr;
+    byte_t* end_ = nullptr;
+    bool ok_ = true;
+
+    /** @brief Cek n byte muat; jika tidak tandai gagal (write berikutnya diabaikan) */
+    [[nodiscard]] bool require(size_type n) noexcept {
+        if (ok_ && static_cast<size_type>(end_ - pos_) >= n) [[likely]] return true;
+        ok_ = false;
+        return false;
+    }
+
+public:
+    constexpr byte_writer() noexcept = default;
+    constexpr explicit byte_writer(std::span<byte_t> buffer) noexcept
+        : begin_(buffer.data()), pos_(buffer.data()), end_(buffer.data() + buffer.size()) {}
+
+    // ============= State =============
+
+    /** @brief False jika pernah ada write yang tidak muat */
+    [[nodiscard]] constexpr bool ok() const noexcept { return ok_; }
+    [[nodiscard]] constexpr explicit operator bool() const noexcept { return ok_; }
+
+    constexpr void fail() noexcept { ok_ = false; }
+
+    [[nodiscard]] constexpr size_type position() const noexcept { return static_cast<size_type>(pos_ - begin_); }
+    [[nodiscard]] constexpr size_type remaining() const noexcept { return static_cast<size_type>(end_ - pos_); }
+    [[nodiscard]] constexpr size_type capacity() const noexcept { return static_cast<size_type>(end_ - begin_); }
+
+    /** @brief Pointer ke posisi tulis berikutnya */
+    [[nodiscard]] constexpr byte_t* current() const noexcept { return pos_; }
+
+    /** @brief Byte yang sudah ditulis */
+    [[nodiscard]] constexpr std::span<byte_t> written() const noexcept { return { begin_, position() }; }
+
+    // ============= Write =============
+
+    /** @brief Tulis T little-endian */
+    template <detail::byte_swap_scalar T>
+    bool write_le(std::type_identity_t<T> v) noexcept {
+        if (!require(sizeof(T))) return false;
+        store_le<T>(pos_, v);
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    /** @brief Tulis T big-endian */
+    template <detail::byte_swap_scalar T>
+    bool write_be(std::type_identity_t<T> v) noexcept {
+        if (!require(sizeof(T))) return false;
+        store_be<T>(pos_, v);
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    /** @brief Tulis T dengan byte order runtime */
+    template <detail::byte_swap_scalar T>
+    bool write(std::type_identity_t<T> v, endian_t order) noexcept {
+        return order == endian_t::big ? write_be<T>(v) : write_le<T>(v);
+    }
+
+    /** @brief Tulis sizeof(T) byte apa adanya (layout native) */
+    template <typename T>
+    requires std::is_trivially_copyable_v<T>
+    bool write_raw(const T& v) noexcept {
+        if (!require(sizeof(T))) return false;
+        std::memcpy(pos_, &v, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    /** @brief Copy src ke buffer */
+    bool write_bytes(std::span<const byte_t> src) noexcept {
+        if (!require(src.size())) return false;
+        if (!src.empty()) std::memcpy(pos_, src.data(), src.size());
+        pos_ += src.size();
+        return true;
+    }
+
+    /** @brief Isi n byte dengan value */
+    bool fill(size_type n, byte_t value = 0) noexcept {
+        if (!require(n)) return false;
+        std::memset(pos_, value, n);
+        pos_ += n;
+        return true;
+    }
+
+    /** @brief Tulis varint LEB128 (ULEB128 untuk unsigned, SLEB128 untuk signed) */
+    template <detail::varint_integer T>
+    bool write_varint(T v) noexcept {
+        if (remaining() >= detail::varint_max_bytes<T>) [[likely]] {
+            if (!ok_) return false;
+            pos_ += detail::encode_varint(pos_, v);
+            return true;
+        }
+        if (!require(detail::varint_size(v))) return false;
+        pos_ += detail::encode_varint(pos_, v);
+        return true;
+    }
+
+    // ============= Batched =============
+
+    /**
+     * @brief Cadangkan n byte sebagai record_writer dengan satu bounds check
+     * @return record_writer kosong (false) dan stream gagal jika tidak muat
+     */
+    [[nodiscard]] record_writer take(size_type n) noexcept {
+        if (!require(n)) return {};
+        byte_t* p = pos_;
+        pos_ += n;
+        return { p, n };
+    }
+};
+
+// ============= Refilling Reader =============
+
+/**
+ * @brief byte_reader di atas buffer yang diisi ulang lewat callback
+ * @tparam Refill Callable `size_t(std::span<uint8_t>)`: isi span, return jumlah
+ *         byte yang ditulis, 0 berarti end of stream
+ *
+ * Buffer disediakan caller (tanpa alokasi). Saat data kurang, sisa byte
+ * dipindah ke awal buffer dan refill dipanggil sampai cukup atau EOF.
+ * Record / field tidak boleh lebih besar dari buffer.
+ *
+ * @note Span / record_reader hasil read_bytes(n) dan take(n) hanya valid
+ *       sampai operasi berikutnya pada stream
+ *
+ * @example
+ * ```cpp
+ * uint8_t buf[64 * 1024];
+ * stream_reader in(buf, [&](std::span<uint8_t> dst) {
+ *     return std::fread(dst.data(), 1, dst.size(), file);
+ * });
+ * while (auto rec = in.take(14)) { ... }
+ * ```
+ */
+template <typename Refill>
+requires std::is_invocable_r_v<size_t, Refill&, std::span<uint8_t>>
+class stream_reader {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+
+private:
+    static constexpr bool nothrow_refill = std::is_nothrow_invocable_v<Refill&, std::span<byte_t>>;
+
+    std::span<byte_t> buffer_;
+    Refill refill_;
+    byte_reader reader_;
+    size_type base_ = 0;   // offset absolut awal buffer_
+    bool eof_ = false;
+
+    /** @brief Compact lalu refill sampai tersedia n byte, buffer penuh atau EOF */
+    void refill_slow(size_type n) noexcept(nothrow_refill) {
+        if (!reader_.ok()) return;
+        const size_type left = reader_.remaining();
+        if (left && reader_.current() != buffer_.data())
+            std::memmove(buffer_.data(), reader_.current(), left);
+        base_ += reader_.position();
+        size_type filled = left;
+        while (filled < n && filled < buffer_.size() && !eof_) {
+            const size_type got = refill_(buffer_.subspan(filled));
+            if (got == 0) eof_ = true;
+            filled += got;
+        }
+        reader_ = byte_reader(buffer_.first(filled));
+    }
+
+    /** @brief Usahakan n byte tersedia; kekurangan ditangani require() reader */
+    void ensure(size_type n) noexcept(nothrow_refill) {
+        if (reader_.remaining() < n) [[unlikely]] refill_slow(n);
+    }
+
+public:
+    stream_reader(std::span<byte_t> buffer, Refill refill)
+        noexcept(std::is_nothrow_move_constructible_v<Refill>)
+        : buffer_(buffer), refill_(std::move(refill)), reader_(buffer.first(0)) {}
+
+    // ============= State =============
+
+    [[nodiscard]] bool ok() const noexcept { return reader_.ok(); }
+    [[nodiscard]] explicit operator bool() const noexcept { return reader_.ok(); }
+
+    void fail() noexcept { reader_.fail(); }
+
+    /** @brief Offset absolut dalam stream */
+    [[nodiscard]] size_type position() const noexcept { return base_ + reader_.position(); }
+
+    /** @brief True jika tidak ada data tersisa (refill dicoba bila buffer kosong) */
+    [[nodiscard]] bool at_end() noexcept(nothrow_refill) {
+        ensure(1);
+        return reader_.empty();
+    }
+
+    /** @brief Byte yang sudah ada di buffer dan belum dibaca */
+    [[nodiscard]] std::span<const byte_t> buffered() const noexcept { return reader_.rest(); }
+
+    // ============= Read =============
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_le() noexcept(nothrow_refill) {
+        ensure(sizeof(T));
+        return reader_.template read_le<T>();
+    }
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read_be() noexcept(nothrow_refill) {
+        ensure(sizeof(T));
+        return reader_.template read_be<T>();
+    }
+
+    template <detail::byte_swap_scalar T>
+    [[nodiscard]] T read(endian_t order) noexcept(nothrow_refill) {
+        ensure(sizeof(T));
+        return reader_.template read<T>(order);
+    }
+
+    template <typename T>
+    requires std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>
+    [[nodiscard]] T read_raw() noexcept(nothrow_refill) {
+        ensure(sizeof(T));
+        return reader_.template read_raw<T>();
+    }
+
+    template <size_t N>
+    [[nodiscard]] bytes<N> read_bytes() noexcept(nothrow_refill) {
+        ensure(N);
+        return reader_.template read_bytes<N>();
+    }
+
+    /** @brief n byte berikutnya tanpa copy (n <= ukuran buffer) */
+    [[nodiscard]] std::span<const byte_t> read_bytes(size_type n) noexcept(nothrow_refill) {
+        ensure(n);
+        return reader_.read_bytes(n);
+    }
+
+    template <detail::varint_integer T>
+    [[nodiscard]] T read_varint() noexcept(nothrow_refill) {
+        ensure(detail::varint_max_bytes<T>);
+        return reader_.template read_varint<T>();
+    }
+
+    /** @brief Satu bounds check untuk n byte (n <= ukuran buffer) */
+    [[nodiscard]] record_reader take(size_type n) noexcept(nothrow_refill) {
+        ensure(n);
+        return reader_.take(n);
+    }
+
+    /** @brief Copy dst.size() byte ke dst (boleh lebih besar dari buffer) */
+    bool read_into(std::span<byte_t> dst) noexcept(nothrow_refill) {
+        while (!dst.empty() && reader_.ok()) {
+            ensure(1);
+            const size_type n = reader_.remaining() < dst.size() ? reader_.remaining() : dst.size();
+            if (n == 0) {
+                reader_.fail();
+                break;
+            }
+            (void)reader_.read_into(dst.first(n));
+            dst = dst.subspan(n);
+        }
+        return reader_.ok();
+    }
+
+    /** @brief Lewati n byte (boleh lebih besar dari buffer) */
+    bool skip(size_type n) noexcept(nothrow_refill) {
+        while (n && reader_.ok()) {
+            ensure(1);
+            const size_type k = reader_.remaining() < n ? reader_.remaining() : n;
+            if (k == 0) {
+                reader_.fail();
+                break;
+            }
+            (void)reader_.skip(k);
+            n -= k;
+        }
+        return reader_.ok();
+    }
+};
+
+} // namespace zuu
@@ -11,12 +11,741 @@
 
 #include "endian.hpp"
 #include <algorithm>
+#include <array>
 #include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#define ZUU_BYTES_SSE2 1
+#endif
+#if defined(__AVX2__)
+#define ZUU_BYTES_AVX2 1
+#endif
+#if defined(__AVX512F__)
+#define ZUU_BYTES_AVX512 1
+#endif
 
 namespace zuu {
 
+namespace detail {
+
+// ============= Bitwise Kernels =============
+//
+// Kernel dipilih saat compile (flag -msse2 / -mavx2 / -mavx512f):
+// AVX-512 (64 B) -> AVX2 (32 B) -> SSE2 (16 B) -> word 64-bit -> byte.
+// Saat constant evaluation selalu memakai byte loop.
+
+struct bit_or {
+    template <typename T>
+    static constexpr T apply(T a, T b) noexcept { return static_cast<T>(a | b); }
+#ifdef ZUU_BYTES_SSE2
+    static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_or_si128(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX2
+    static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_or_si256(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX512
+    static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_or_si512(a, b); }
+#endif
+};
+
+struct bit_and {
+    template <typename T>
+    static constexpr T apply(T a, T b) noexcept { return static_cast<T>(a & b); }
+#ifdef ZUU_BYTES_SSE2
+    static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_and_si128(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX2
+    static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_and_si256(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX512
+    static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_and_si512(a, b); }
+#endif
+};
+
+struct bit_xor {
+    template <typename T>
+    static constexpr T apply(T a, T b) noexcept { return static_cast<T>(a ^ b); }
+#ifdef ZUU_BYTES_SSE2
+    static __m128i apply(__m128i a, __m128i b) noexcept { return _mm_xor_si128(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX2
+    static __m256i apply(__m256i a, __m256i b) noexcept { return _mm256_xor_si256(a, b); }
+#endif
+#ifdef ZUU_BYTES_AVX512
+    static __m512i apply(__m512i a, __m512i b) noexcept { return _mm512_xor_si512(a, b); }
+#endif
+};
+
+/** @brief ~a (operand kedua diabaikan) */
+struct bit_not {
+    template <typename T>
+    static constexpr T apply(T a, T) noexcept { return static_cast<T>(~a); }
+#ifdef ZUU_BYTES_SSE2
+    static __m128i apply(__m128i a, __m128i) noexcept { return _mm_xor_si128(a, _mm_set1_epi32(-1)); }
+#endif
+#ifdef ZUU_BYTES_AVX2
+    static __m256i apply(__m256i a, __m256i) noexcept { return _mm256_xor_si256(a, _mm256_set1_epi32(-1)); }
+#endif
+#ifdef ZUU_BYTES_AVX512
+    static __m512i apply(__m512i a, __m512i) noexcept { return _mm512_ternarylogic_epi32(a, a, a, 0x55); }
+#endif
+};
+
+/**
+ * @brief dst[i] = Op(a[i], b[i]) untuk i in [0, n)
+ * @note dst boleh sama dengan a atau b (in-place)
+ */
+template <typename Op>
+constexpr void bitwise_kernel(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < n; ++i) dst[i] = Op::apply(a[i], b[i]);
+        return;
+    }
+
+    size_t i = 0;
+#ifdef ZUU_BYTES_AVX512
+    for (; i + 64 <= n; i += 64) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        const __m512i y = _mm512_loadu_si512(b + i);
+        _mm512_storeu_si512(dst + i, Op::apply(x, y));
+    }
+#endif
+#ifdef ZUU_BYTES_AVX2
+    for (; i + 32 <= n; i += 32) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::apply(x, y));
+    }
+#endif
+#ifdef ZUU_BYTES_SSE2
+    for (; i + 16 <= n; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(x, y));
+    }
+#endif
+    for (; i + 8 <= n; i += 8) {
+        uint64_t x, y;
+        std::memcpy(&x, a + i, 8);
+        std::memcpy(&y, b + i, 8);
+        x = Op::apply(x, y);
+        std::memcpy(dst + i, &x, 8);
+    }
+    for (; i < n; ++i) dst[i] = Op::apply(a[i], b[i]);
+}
+
+// ============= Shift Kernels =============
+//
+// Buffer diperlakukan sebagai integer little-endian n byte; setiap 8 byte
+// output dihitung dari dua word 64-bit (funnel shift), bukan per byte.
+// Saat constant evaluation memakai byte loop.
+
+/** @brief Load word 64-bit little-endian di offset byte off; byte di luar [0, n) dianggap 0 */
+[[nodiscard]] inline uint64_t shift_load(const uint8_t* p, size_t n, ptrdiff_t off) noexcept {
+    if (off >= 0 && static_cast<size_t>(off) + 8 <= n) {
+        uint64_t w;
+        std::memcpy(&w, p + off, 8);
+        return from_little_endian(w);
+    }
+    uint64_t w = 0;
+    for (ptrdiff_t k = 0; k < 8; ++k) {
+        const ptrdiff_t i = off + k;
+        if (i >= 0 && static_cast<size_t>(i) < n) w |= static_cast<uint64_t>(p[i]) << (k * 8);
+    }
+    return w;
+}
+
+/** @brief Store len (<= 8) byte rendah dari w ke p + off (little-endian) */
+inline void shift_store(uint8_t* p, size_t off, size_t len, uint64_t w) noexcept {
+    if (len == 8) {
+        w = to_little_endian(w);
+        std::memcpy(p + off, &w, 8);
+        return;
+    }
+    for (size_t k = 0; k < len; ++k) p[off + k] = static_cast<uint8_t>(w >> (k * 8));
+}
+
+/** @brief Load word 64-bit little-endian di p (tanpa bounds check) */
+[[nodiscard]] inline uint64_t shift_word(const uint8_t* p) noexcept {
+    uint64_t w;
+    std::memcpy(&w, p, 8);
+    return from_little_endian(w);
+}
+
+/** @brief (hi << b) | (lo >> (64 - b)) untuk b in [0, 8) tanpa branch */
+[[nodiscard]] constexpr uint64_t funnel_left(uint64_t hi, uint64_t lo, unsigned b) noexcept {
+    return (hi << b) | ((lo >> 1) >> (63 - b));
+}
+
+/** @brief (lo >> b) | (hi << (64 - b)) untuk b in [0, 8) tanpa branch */
+[[nodiscard]] constexpr uint64_t funnel_right(uint64_t lo, uint64_t hi, unsigned b) noexcept {
+    return (lo >> b) | ((hi << 1) << (63 - b));
+}
+
+/**
+ * @brief dst = src << bits (n byte)
+ * @note dst boleh sama dengan src; output ditulis dari word tertinggi ke bawah
+ */
+constexpr void shift_left_kernel(uint8_t* dst, const uint8_t* src, size_t n, size_t bits) noexcept {
+    if (bits >= n * 8) {
+        for (size_t i = 0; i < n; ++i) dst[i] = 0;
+        return;
+    }
+    const size_t byte_sh = bits / 8;
+    const unsigned bit_sh = static_cast<unsigned>(bits % 8);
+
+    if (std::is_constant_evaluated()) {
+        for (size_t i = n; i-- > byte_sh;) {
+            const uint8_t lo = i > byte_sh ? src[i - byte_sh - 1] : 0;
+            dst[i] = bit_sh ? static_cast<uint8_t>((src[i - byte_sh] << bit_sh) | (lo >> (8 - bit_sh)))
+                            : src[i - byte_sh];
+        }
+        for (size_t i = 0; i < byte_sh; ++i) dst[i] = 0;
+        return;
+    }
+
+    size_t j = n;
+    // Word interior: kedua word sumber berada di dalam buffer
+    for (; j >= byte_sh + 16; j -= 8) {
+        const uint8_t* s = src + (j - 8 - byte_sh);
+        shift_store(dst, j - 8, 8, funnel_left(shift_word(s), shift_word(s - 8), bit_sh));
+    }
+    const ptrdiff_t sh = static_cast<ptrdiff_t>(byte_sh);
+    while (j > 0) {
+        const size_t len = j >= 8 ? 8 : j;
+        j -= len;
+        const ptrdiff_t at = static_cast<ptrdiff_t>(j + len) - 8 - sh;
+        const uint64_t w = funnel_left(shift_load(src, n, at), shift_load(src, n, at - 8), bit_sh);
+        shift_store(dst, j, len, w >> ((8 - len) * 8));
+    }
+}
+
+/**
+ * @brief dst = src >> bits (n byte)
+ * @note dst boleh sama dengan src; output ditulis dari word terendah ke atas
+ */
+constexpr void shift_right_kernel(uint8_t* dst, const uint8_t* src, size_t n, size_t bits) noexcept {
+    if (bits >= n * 8) {
+        for (size_t i = 0; i < n; ++i) dst[i] = 0;
+        return;
+    }
+    const size_t byte_sh = bits / 8;
+    const unsigned bit_sh = static_cast<unsigned>(bits % 8);
+
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i + byte_sh < n; ++i) {
+            const uint8_t hi = i + byte_sh + 1 < n ? src[i + byte_sh + 1] : 0;
+            dst[i] = bit_sh ? static_cast<uint8_t>((src[i + byte_sh] >> bit_sh) | (hi << (8 - bit_sh)))
+                            : src[i + byte_sh];
+        }
+        for (size_t i = n - byte_sh; i < n; ++i) dst[i] = 0;
+        return;
+    }
+
+    size_t j = 0;
+    for (; j + byte_sh + 16 <= n; j += 8) {
+        const uint8_t* s = src + (j + byte_sh);
+        shift_store(dst, j, 8, funnel_right(shift_word(s), shift_word(s + 8), bit_sh));
+    }
+    const ptrdiff_t sh = static_cast<ptrdiff_t>(byte_sh);
+    for (; j < n; j += 8) {
+        const size_t len = n - j >= 8 ? 8 : n - j;
+        const ptrdiff_t at = static_cast<ptrdiff_t>(j) + sh;
+        const uint64_t w = funnel_right(shift_load(src, n, at), shift_load(src, n, at + 8), bit_sh);
+        shift_store(dst, j, len, w);
+    }
+}
+
+/** @brief Load word 64-bit little-endian secara siklik (offset modulo n) */
+[[nodiscard]] inline uint64_t rotate_load(const uint8_t* p, size_t n, size_t off) noexcept {
+    off %= n;
+    if (off + 8 <= n) return shift_word(p + off);
+    uint64_t w = 0;
+    for (size_t k = 0; k < 8; ++k) w |= static_cast<uint64_t>(p[(off + k) % n]) << (k * 8);
+    return w;
+}
+
+/**
+ * @brief dst = rotl(src, bits) (n byte)
+ * @note dst tidak boleh overlap dengan src
+ */
+constexpr void rotate_left_kernel(uint8_t* dst, const uint8_t* src, size_t n, size_t bits) noexcept {
+    bits %= n * 8;
+    const size_t byte_sh = bits / 8;
+    const unsigned bit_sh = static_cast<unsigned>(bits % 8);
+
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < n; ++i) {
+            const uint8_t hi = src[(i + n - byte_sh) % n];
+            const uint8_t lo = src[(i + 2 * n - byte_sh - 1) % n];
+            dst[i] = bit_sh ? static_cast<uint8_t>((hi << bit_sh) | (lo >> (8 - bit_sh))) : hi;
+        }
+        return;
+    }
+
+    // Output byte j berasal dari byte sumber (j - byte_sh) mod n; offset
+    // sumber dilacak inkremental, load siklik hanya di sekitar titik wrap
+    const size_t wrap = 8 * n;
+    size_t hi = (n - byte_sh) % n;
+    size_t j = 0;
+    for (; j + 8 <= n; j += 8) {
+        const uint64_t h = hi + 8 <= n ? shift_word(src + hi) : rotate_load(src, n, hi);
+        const uint64_t l = hi >= 8 ? shift_word(src + hi - 8) : rotate_load(src, n, hi + wrap - 8);
+        shift_store(dst, j, 8, funnel_left(h, l, bit_sh));
+        hi += 8;
+        if (hi >= n) hi -= n;
+    }
+    if (j < n) {
+        const size_t len = n - j;
+        const size_t at = hi + len + wrap - 8;
+        const uint64_t w = funnel_left(rotate_load(src, n, at), rotate_load(src, n, at + wrap - 8), bit_sh);
+        shift_store(dst, j, len, w >> ((8 - len) * 8));
+    }
+}
+
+/**
+ * @brief Rotate-left in-place tanpa buffer sementara (n byte)
+ *
+ * Rotasi byte memakai std::rotate, sisa 0-7 bit diproses per word dari atas
+ * ke bawah dengan carry dari byte teratas. Dipakai buffer runtime-sized yang
+ * tidak bisa menyalin sumber ke stack.
+ */
+constexpr void rotate_left_inplace_kernel(uint8_t* p, size_t n, size_t bits) noexcept {
+    if (n == 0) return;
+    bits %= n * 8;
+    if (bits == 0) return;
+    const size_t byte_sh = bits / 8;
+    const unsigned bit_sh = static_cast<unsigned>(bits % 8);
+
+    if (byte_sh) std::rotate(p, p + (n - byte_sh), p + n);
+    if (!bit_sh) return;
+
+    const uint8_t wrap = static_cast<uint8_t>(p[n - 1] >> (8 - bit_sh));
+    if (std::is_constant_evaluated()) {
+        for (size_t i = n; i-- > 1;)
+            p[i] = static_cast<uint8_t>((p[i] << bit_sh) | (p[i - 1] >> (8 - bit_sh)));
+        p[0] = static_cast<uint8_t>((p[0] << bit_sh) | wrap);
+        return;
+    }
+
+    size_t j = n;
+    while (j > 0) {
+        const size_t len = j >= 8 ? 8 : j;
+        j -= len;
+        const ptrdiff_t at = static_cast<ptrdiff_t>(j + len) - 8;
+        uint64_t w = shift_load(p, n, at) << bit_sh;
+        w |= j > 0 ? shift_load(p, n, at - 8) >> (64 - bit_sh)
+                   : static_cast<uint64_t>(wrap) << ((8 - len) * 8);
+        shift_store(p, j, len, w >> ((8 - len) * 8));
+    }
+}
+
+// ============= Bit Scan Kernels =============
+//
+// Bitmap n byte dibaca sebagai word 64-bit little-endian (bit pos berada di
+// byte pos / 8, bit pos % 8). Word terakhir yang parsial diisi nol.
+
+inline constexpr size_t bit_npos = static_cast<size_t>(-1);
+
+/** @brief Load word ke-w dari bitmap n byte (constexpr) */
+[[nodiscard]] constexpr uint64_t bit_word(const uint8_t* p, size_t n, size_t w) noexcept {
+    const size_t off = w * 8;
+    if (!std::is_constant_evaluated() && off + 8 <= n) return shift_word(p + off);
+    uint64_t v = 0;
+    const size_t end = off + 8 < n ? off + 8 : n;
+    for (size_t i = off; i < end; ++i) v |= static_cast<uint64_t>(p[i]) << ((i - off) * 8);
+    return v;
+}
+
+/**
+ * @brief popcount 64-bit
+ * @note Tanpa instruksi POPCNT (mis. -O2 tanpa -mpopcnt) std::popcount memanggil
+ *       fungsi libgcc; versi SWAR di sini jauh lebih cepat
+ */
+[[nodiscard]] constexpr unsigned popcount64(uint64_t w) noexcept {
+#if defined(__POPCNT__) || defined(_MSC_VER)
+    return static_cast<unsigned>(std::popcount(w));
+#else
+    w -= (w >> 1) & 0x5555555555555555ull;
+    w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<unsigned>((w * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+/** @brief Posisi bit set ke-k (0-based) di dalam word; k < popcount(w) */
+[[nodiscard]] constexpr unsigned select_in_word(uint64_t w, unsigned k) noexcept {
+#if defined(__BMI2__) && defined(ZUU_BYTES_SSE2)
+    if (!std::is_constant_evaluated())
+        return static_cast<unsigned>(std::countr_zero(_pdep_u64(uint64_t{1} << k, w)));
+#endif
+    unsigned base = 0;
+    for (;;) {
+        const unsigned c = popcount64(w & 0xFF);
+        if (k < c) break;
+        k -= c;
+        w >>= 8;
+        base += 8;
+    }
+    for (; k > 0; --k) w &= w - 1;
+    return base + static_cast<unsigned>(std::countr_zero(w));
+}
+
+[[nodiscard]] constexpr size_t popcount_kernel(const uint8_t* p, size_t n) noexcept {
+    size_t c = 0;
+    size_t i = 0;
+    if (!std::is_constant_evaluated()) {
+        for (; i + 8 <= n; i += 8) c += popcount64(shift_word(p + i));
+    }
+    for (; i < n; i += 8) c += popcount64(bit_word(p, n, i / 8));
+    return c;
+}
+
+/** @brief Bit set pertama dengan posisi >= pos, atau bit_npos */
+[[nodiscard]] constexpr size_t find_next_set_kernel(const uint8_t* p, size_t n, size_t pos) noexcept {
+    if (pos >= n * 8) return bit_npos;
+    const size_t words = (n + 7) / 8;
+    size_t w = pos / 64;
+    uint64_t v = bit_word(p, n, w) & (~uint64_t{0} << (pos % 64));
+    while (v == 0) {
+        if (++w == words) return bit_npos;
+        v = bit_word(p, n, w);
+    }
+    return w * 64 + static_cast<size_t>(std::countr_zero(v));
+}
+
+/** @brief Bit set terakhir, atau bit_npos */
+[[nodiscard]] constexpr size_t find_last_set_kernel(const uint8_t* p, size_t n) noexcept {
+    for (size_t w = (n + 7) / 8; w-- > 0;) {
+        const uint64_t v = bit_word(p, n, w);
+        if (v) return w * 64 + 63 - static_cast<size_t>(std::countl_zero(v));
+    }
+    return bit_npos;
+}
+
+/** @brief Jumlah bit set di [a, b) */
+[[nodiscard]] constexpr size_t count_range_kernel(const uint8_t* p, size_t n, size_t a, size_t b) noexcept {
+    if (b > n * 8) b = n * 8;
+    if (a >= b) return 0;
+    const size_t wa = a / 64, wb = (b - 1) / 64;
+    const uint64_t lo = ~uint64_t{0} << (a % 64);
+    const uint64_t hi = ~uint64_t{0} >> (63 - (b - 1) % 64);
+    if (wa == wb) return static_cast<size_t>(popcount64(bit_word(p, n, wa) & lo & hi));
+    size_t c = static_cast<size_t>(popcount64(bit_word(p, n, wa) & lo));
+    for (size_t w = wa + 1; w < wb; ++w) c += static_cast<size_t>(popcount64(bit_word(p, n, w)));
+    return c + static_cast<size_t>(popcount64(bit_word(p, n, wb) & hi));
+}
+
+/** @brief Posisi bit set ke-k (0-based) mulai dari word first, atau bit_npos */
+[[nodiscard]] constexpr size_t select_kernel(const uint8_t* p, size_t n, size_t k, size_t first = 0) noexcept {
+    const size_t words = (n + 7) / 8;
+    for (size_t w = first; w < words; ++w) {
+        const uint64_t v = bit_word(p, n, w);
+        const size_t c = static_cast<size_t>(popcount64(v));
+        if (k < c) return w * 64 + select_in_word(v, static_cast<unsigned>(k));
+        k -= c;
+    }
+    return bit_npos;
+}
+
+// ============= Wide Integer Kernels =============
+//
+// bytes<N> sebagai unsigned integer little-endian 8N bit. Operasi dilakukan
+// pada array word 64-bit (word teratas parsial diisi nol saat load dan
+// dipotong saat store), sehingga hasil otomatis modulo 2^(8N).
+
+template <size_t N>
+using wide_words = std::array<uint64_t, (N + 7) / 8>;
+
+/** @brief Store word ke-w ke bitmap n byte (dipotong di akhir buffer, constexpr) */
+constexpr void bit_store(uint8_t* p, size_t n, size_t w, uint64_t v) noexcept {
+    const size_t off = w * 8;
+    if (!std::is_constant_evaluated() && off + 8 <= n) {
+        shift_store(p, off, 8, v);
+        return;
+    }
+    const size_t end = off + 8 < n ? off + 8 : n;
+    for (size_t i = off; i < end; ++i) p[i] = static_cast<uint8_t>(v >> ((i - off) * 8));
+}
+
+template <size_t N>
+[[nodiscard]] constexpr wide_words<N> load_words(const uint8_t* p) noexcept {
+    wide_words<N> w{};
+    if (!std::is_constant_evaluated()) {
+        std::memcpy(w.data(), p, N);
+        if constexpr (!is_little_endian) {
+            for (auto& x : w) x = from_little_endian(x);
+        }
+        return w;
+    }
+    for (size_t i = 0; i < w.size(); ++i) w[i] = bit_word(p, N, i);
+    return w;
+}
+
+template <size_t N>
+constexpr void store_words(uint8_t* p, wide_words<N> w) noexcept {
+    if (!std::is_constant_evaluated()) {
+        if constexpr (!is_little_endian) {
+            for (auto& x : w) x = to_little_endian(x);
+        }
+        std::memcpy(p, w.data(), N);
+        return;
+    }
+    for (size_t i = 0; i < w.size(); ++i) bit_store(p, N, i, w[i]);
+}
+
+/** @brief a + b + carry; carry diperbarui (add-with-carry) */
+[[nodiscard]] constexpr uint64_t add_carry(uint64_t a, uint64_t b, unsigned char& carry) noexcept {
+#if defined(ZUU_BYTES_SSE2) && defined(__x86_64__)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long r;
+        carry = _addcarry_u64(carry, a, b, &r);
+        return r;
+    }
+#endif
+    const uint64_t s = a + b;
+    const uint64_t r = s + carry;
+    carry = static_cast<unsigned char>((s < a) | (r < s));
+    return r;
+}
+
+/** @brief a - b - borrow; borrow diperbarui (subtract-with-borrow) */
+[[nodiscard]] constexpr uint64_t sub_borrow(uint64_t a, uint64_t b, unsigned char& borrow) noexcept {
+#if defined(ZUU_BYTES_SSE2) && defined(__x86_64__)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long r;
+        borrow = _subborrow_u64(borrow, a, b, &r);
+        return r;
+    }
+#endif
+    const uint64_t d = a - b;
+    const uint64_t r = d - borrow;
+    borrow = static_cast<unsigned char>((a < b) | (d < borrow));
+    return r;
+}
+
+/** @brief 64x64 -> 128 multiply; mengembalikan word rendah, hi = word tinggi */
+[[nodiscard]] constexpr uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t& hi) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const uint128_t r = static_cast<uint128_t>(a) * b;
+    hi = static_cast<uint64_t>(r >> 64);
+    return static_cast<uint64_t>(r);
+#else
+    const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    const uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo;
+#endif
+}
+
+/** @brief a += b (mod 2^(64W)); mengembalikan carry keluar */
+template <size_t W>
+constexpr bool add_words(std::array<uint64_t, W>& a, const std::array<uint64_t, W>& b) noexcept {
+    unsigned char c = 0;
+    // Fold (unrolled penuh) agar word tetap di register dan rantai adc tidak terputus
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((a[I] = add_carry(a[I], b[I], c)), ...);
+    }(std::make_index_sequence<W>{});
+    return c != 0;
+}
+
+/** @brief a -= b (mod 2^(64W)); mengembalikan borrow keluar */
+template <size_t W>
+constexpr bool sub_words(std::array<uint64_t, W>& a, const std::array<uint64_t, W>& b) noexcept {
+    unsigned char c = 0;
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        ((a[I] = sub_borrow(a[I], b[I], c)), ...);
+    }(std::make_index_sequence<W>{});
+    return c != 0;
+}
+
+/** @brief a * b dipotong ke W word (schoolbook, hanya partial product yang dibutuhkan) */
+template <size_t W>
+[[nodiscard]] constexpr std::array<uint64_t, W> mul_words(const std::array<uint64_t, W>& a,
+                                                          const std::array<uint64_t, W>& b) noexcept {
+    std::array<uint64_t, W> r{};
+    for (size_t i = 0; i < W; ++i) {
+        if (a[i] == 0) continue;
+        uint64_t carry = 0;
+        for (size_t j = 0; i + j < W; ++j) {
+            uint64_t hi;
+            const uint64_t lo = mul_wide(a[i], b[j], hi);
+            unsigned char c = 0;
+            r[i + j] = add_carry(r[i + j], lo, c);
+            hi += c;
+            c = 0;
+            r[i + j] = add_carry(r[i + j], carry, c);
+            carry = hi + c;
+        }
+    }
+    return r;
+}
+
+/** @brief a *= m (skalar 64-bit) */
+template <size_t W>
+constexpr void mul_words_scalar(std::array<uint64_t, W>& a, uint64_t m) noexcept {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < W; ++i) {
+        uint64_t hi;
+        const uint64_t lo = mul_wide(a[i], m, hi);
+        unsigned char c = 0;
+        a[i] = add_carry(lo, carry, c);
+        carry = hi + c;
+    }
+}
+
+/**
+ * @brief a /= d, mengembalikan a % d (d != 0, d < 2^32)
+ *
+ * Setiap word dibagi per setengah 32-bit sehingga dividen parsial
+ * (rem << 32 | half) muat di 64-bit: cukup div 64/64 native, tanpa 128/64.
+ */
+template <size_t W>
+constexpr uint32_t div_words_small(std::array<uint64_t, W>& a, uint32_t d) noexcept {
+    uint64_t rem = 0;
+    for (size_t i = W; i-- > 0;) {
+        const uint64_t hi = (rem << 32) | (a[i] >> 32);
+        const uint64_t qh = hi / d;
+        rem = hi % d;
+        const uint64_t lo = (rem << 32) | (a[i] & 0xFFFFFFFFu);
+        const uint64_t ql = lo / d;
+        rem = lo % d;
+        a[i] = (qh << 32) | ql;
+    }
+    return static_cast<uint32_t>(rem);
+}
+
+/**
+ * @brief Perbandingan leksikografis byte (urutan memcmp)
+ *
+ * Runtime: 8 byte dibaca sekaligus sebagai word big-endian, sehingga urutan
+ * integer word sama dengan urutan byte-nya.
+ */
+[[nodiscard]] constexpr std::strong_ordering compare_lex_kernel(const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    size_t i = 0;
+    if (!std::is_constant_evaluated()) {
+        for (; i + 8 <= n; i += 8) {
+            uint64_t x, y;
+            std::memcpy(&x, a + i, 8);
+            std::memcpy(&y, b + i, 8);
+            if (x != y) {
+                x = from_big_endian(x);
+                y = from_big_endian(y);
+                return x < y ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+        }
+    }
+    for (; i < n; ++i)
+        if (a[i] != b[i]) return a[i] <=> b[i];
+    return std::strong_ordering::equal;
+}
+
+/** @brief Perbandingan numerik dari word paling signifikan ke bawah */
+[[nodiscard]] constexpr std::strong_ordering compare_numeric_kernel(const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    for (size_t w = (n + 7) / 8; w-- > 0;) {
+        const uint64_t x = bit_word(a, n, w);
+        const uint64_t y = bit_word(b, n, w);
+        if (x != y) return x < y ? std::strong_ordering::less : std::strong_ordering::greater;
+    }
+    return std::strong_ordering::equal;
+}
+
+} // namespace detail
+
+// ============= Set Bit View =============
+
+/**
+ * @brief Range non-owning atas posisi bit set dalam bitmap n byte
+ *
+ * Iterator melompat langsung ke bit set berikutnya memakai countr_zero per
+ * word 64-bit, sehingga iterasi O(popcount + n / 8), bukan O(bit_count).
+ * Urutan posisi menaik. Bitmap tidak boleh dimodifikasi selama iterasi.
+ *
+ * @example
+ * ```cpp
+ * bytes<128> bm;
+ * for (size_t pos : bm.set_bits()) { ... }
+ * auto n = std::ranges::distance(bm.set_bits());
+ * ```
+ */
+class set_bits_view : public std::ranges::view_interface<set_bits_view> {
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    class iterator {
+        const uint8_t* data_ = nullptr;
+        size_t size_ = 0;
+        size_t words_ = 0;
+        size_t word_ = 0;
+        uint64_t bits_ = 0; // Sisa bit set pada word_ yang belum dikunjungi
+
+        constexpr void skip_empty() noexcept {
+            while (bits_ == 0 && ++word_ < words_) bits_ = detail::bit_word(data_, size_, word_);
+        }
+
+    public:
+        // operator* mengembalikan prvalue: forward untuk ranges, input untuk legacy
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr iterator(const uint8_t* data, size_t size) noexcept
+            : data_(data), size_(size), words_((size + 7) / 8) {
+            if (size_ == 0) return;
+            bits_ = detail::bit_word(data_, size_, 0);
+            skip_empty();
+        }
+
+        [[nodiscard]] constexpr size_t operator*() const noexcept {
+            return word_ * 64 + static_cast<size_t>(std::countr_zero(bits_));
+        }
+
+        constexpr iterator& operator++() noexcept {
+            bits_ &= bits_ - 1;
+            skip_empty();
+            return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept {
+            iterator t = *this;
+            ++*this;
+            return t;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& o) const noexcept {
+            return word_ == o.word_ && bits_ == o.bits_;
+        }
+
+        [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const noexcept {
+            return bits_ == 0;
+        }
+    };
+
+    constexpr set_bits_view() noexcept = default;
+    constexpr set_bits_view(const uint8_t* data, size_t size) noexcept : data_(data), size_(size) {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(data_, size_); }
+    [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return {}; }
+};
+
 /**
  * @brief Fixed-size byte array dengan operasi bitwise
  * @tparam N Jumlah byte (harus > 0)
@@ -41,6 +770,8 @@ public:
 
     static constexpr size_type byte_count = N;
     static constexpr size_type bit_count = N * 8;
+    /** @brief Hasil find_* / select jika tidak ada bit yang cocok */
+    static constexpr size_type npos = detail::bit_npos;
 
 private:
     alignas(N >= 16 ? 16 : (N >= 8 ? 8 : (N >= 4 ? 4 : 1))) 
@@ -121,79 +852,75 @@ public:
 
     [[nodiscard]] constexpr bytes operator|(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] | o.data_[i];
+        detail::bitwise_kernel<detail::bit_or>(r.data_, data_, o.data_, N);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator&(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] & o.data_[i];
+        detail::bitwise_kernel<detail::bit_and>(r.data_, data_, o.data_, N);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator^(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] ^ o.data_[i];
+        detail::bitwise_kernel<detail::bit_xor>(r.data_, data_, o.data_, N);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator~() const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = ~data_[i];
+        detail::bitwise_kernel<detail::bit_not>(r.data_, data_, data_, N);
         return r;
     }
 
     // ============= Shift Operations =============
 
     [[nodiscard]] constexpr bytes operator<<(size_type bits) const noexcept {
-        if (bits == 0) return *this;
-        if (bits >= bit_count) return bytes{};
-        
         bytes r;
-        const size_type byte_sh = bits / 8;
-        const size_type bit_sh = bits % 8;
-
-        if (bit_sh == 0) {
-            for (size_type i = byte_sh; i < N; ++i) 
-                r.data_[i] = data_[i - byte_sh];
-        } else {
-            byte_t carry = 0;
-            for (size_type i = 0; i < N - byte_sh; ++i) {
-                r.data_[i + byte_sh] = (data_[i] << bit_sh) | carry;
-                carry = data_[i] >> (8 - bit_sh);
-            }
-        }
+        detail::shift_left_kernel(r.data_, data_, N, bits);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator>>(size_type bits) const noexcept {
-        if (bits == 0) return *this;
-        if (bits >= bit_count) return bytes{};
-        
         bytes r;
-        const size_type byte_sh = bits / 8;
-        const size_type bit_sh = bits % 8;
-
-        if (bit_sh == 0) {
-            for (size_type i = 0; i < N - byte_sh; ++i) 
-                r.data_[i] = data_[i + byte_sh];
-        } else {
-            byte_t carry = 0;
-            for (size_type i = N - byte_sh; i-- > 0;) {
-                r.data_[i] = (data_[i + byte_sh] >> bit_sh) | carry;
-                carry = data_[i + byte_sh] << (8 - bit_sh);
-            }
-        }
+        detail::shift_right_kernel(r.data_, data_, N, bits);
         return r;
     }
 
     // ============= Compound Assignment =============
 
-    constexpr bytes& operator|=(const bytes& o) noexcept { return *this = *this | o; }
-    constexpr bytes& operator&=(const bytes& o) noexcept { return *this = *this & o; }
-    constexpr bytes& operator^=(const bytes& o) noexcept { return *this = *this ^ o; }
-    constexpr bytes& operator<<=(size_type n) noexcept { return *this = *this << n; }
-    constexpr bytes& operator>>=(size_type n) noexcept { return *this = *this >> n; }
+    constexpr bytes& operator|=(const bytes& o) noexcept {
+        detail::bitwise_kernel<detail::bit_or>(data_, data_, o.data_, N);
+        return *this;
+    }
+
+    constexpr bytes& operator&=(const bytes& o) noexcept {
+        detail::bitwise_kernel<detail::bit_and>(data_, data_, o.data_, N);
+        return *this;
+    }
+
+    constexpr bytes& operator^=(const bytes& o) noexcept {
+        detail::bitwise_kernel<detail::bit_xor>(data_, data_, o.data_, N);
+        return *this;
+    }
+
+    /** @brief Invert semua bit in-place */
+    constexpr bytes& flip() noexcept {
+        detail::bitwise_kernel<detail::bit_not>(data_, data_, data_, N);
+        return *this;
+    }
+
+    /** @brief Shift in-place tanpa temporary */
+    constexpr bytes& operator<<=(size_type n) noexcept {
+        detail::shift_left_kernel(data_, data_, N, n);
+        return *this;
+    }
+
+    constexpr bytes& operator>>=(size_type n) noexcept {
+        detail::shift_right_kernel(data_, data_, N, n);
+        return *this;
+    }
 
     // ============= Bit Manipulation =============
 
@@ -214,21 +941,199 @@ public:
     }
 
     [[nodiscard]] constexpr size_type popcount() const noexcept {
-        size_type c = 0;
-        for (size_type i = 0; i < N; ++i) c += std::popcount(data_[i]);
-        return c;
+        return detail::popcount_kernel(data_, N);
+    }
+
+    // ============= Bit Scan / Rank / Select =============
+
+    /** @brief Posisi bit set terendah, atau npos */
+    [[nodiscard]] constexpr size_type find_first_set() const noexcept {
+        return detail::find_next_set_kernel(data_, N, 0);
+    }
+
+    /** @brief Posisi bit set tertinggi, atau npos */
+    [[nodiscard]] constexpr size_type find_last_set() const noexcept {
+        return detail::find_last_set_kernel(data_, N);
+    }
+
+    /** @brief Posisi bit set pertama >= pos, atau npos */
+    [[nodiscard]] constexpr size_type find_next_set(size_type pos) const noexcept {
+        return detail::find_next_set_kernel(data_, N, pos);
+    }
+
+    /** @brief Jumlah bit set di [first, last) */
+    [[nodiscard]] constexpr size_type count_range(size_type first, size_type last) const noexcept {
+        return detail::count_range_kernel(data_, N, first, last);
+    }
+
+    /** @brief Jumlah bit set di [0, pos) */
+    [[nodiscard]] constexpr size_type rank(size_type pos) const noexcept {
+        return detail::count_range_kernel(data_, N, 0, pos);
+    }
+
+    /**
+     * @brief Posisi bit set ke-k (0-based), atau npos jika k >= popcount()
+     * @note O(N / 8); gunakan rank_directory untuk N besar
+     */
+    [[nodiscard]] constexpr size_type select(size_type k) const noexcept {
+        return detail::select_kernel(data_, N, k);
+    }
+
+    /**
+     * @brief Range posisi bit set (menaik), lihat set_bits_view
+     * @note View menunjuk ke storage object ini
+     */
+    [[nodiscard]] constexpr set_bits_view set_bits() const noexcept {
+        return set_bits_view(data_, N);
     }
 
     // ============= Rotation =============
 
     [[nodiscard]] constexpr bytes rotate_left(size_type n) const noexcept {
-        n %= bit_count;
-        return (*this << n) | (*this >> (bit_count - n));
+        bytes r;
+        detail::rotate_left_kernel(r.data_, data_, N, n);
+        return r;
     }
 
     [[nodiscard]] constexpr bytes rotate_right(size_type n) const noexcept {
-        n %= bit_count;
-        return (*this >> n) | (*this << (bit_count - n));
+        bytes r;
+        detail::rotate_left_kernel(r.data_, data_, N, bit_count - n % bit_count);
+        return r;
+    }
+
+    /**
+     * @brief Rotate-left in-place
+     * @note Satu salinan sumber di stack (memcpy), lalu satu pass funnel per word
+     */
+    constexpr bytes& rotate_left_inplace(size_type n) noexcept {
+        const bytes src = *this;
+        detail::rotate_left_kernel(data_, src.data_, N, n);
+        return *this;
+    }
+
+    constexpr bytes& rotate_right_inplace(size_type n) noexcept {
+        const bytes src = *this;
+        detail::rotate_left_kernel(data_, src.data_, N, bit_count - n % bit_count);
+        return *this;
+    }
+
+    // ============= Arithmetic =============
+    //
+    // bytes<N> sebagai unsigned integer little-endian 8N bit; semua operasi
+    // modulo 2^(8N) (wrap-around seperti unsigned built-in).
+
+    [[nodiscard]] constexpr bytes operator+(const bytes& o) const noexcept {
+        bytes r = *this;
+        return r += o;
+    }
+
+    [[nodiscard]] constexpr bytes operator-(const bytes& o) const noexcept {
+        bytes r = *this;
+        return r -= o;
+    }
+
+    [[nodiscard]] constexpr bytes operator*(const bytes& o) const noexcept {
+        bytes r;
+        detail::store_words<N>(r.data_, detail::mul_words(detail::load_words<N>(data_), detail::load_words<N>(o.data_)));
+        return r;
+    }
+
+    constexpr bytes& operator+=(const bytes& o) noexcept {
+        auto a = detail::load_words<N>(data_);
+        detail::add_words(a, detail::load_words<N>(o.data_));
+        detail::store_words<N>(data_, a);
+        return *this;
+    }
+
+    constexpr bytes& operator-=(const bytes& o) noexcept {
+        auto a = detail::load_words<N>(data_);
+        detail::sub_words(a, detail::load_words<N>(o.data_));
+        detail::store_words<N>(data_, a);
+        return *this;
+    }
+
+    constexpr bytes& operator*=(const bytes& o) noexcept { return *this = *this * o; }
+
+    // Operand skalar (counter, faktor kecil)
+
+    [[nodiscard]] constexpr bytes operator+(uint64_t v) const noexcept {
+        bytes r = *this;
+        return r += v;
+    }
+
+    [[nodiscard]] constexpr bytes operator-(uint64_t v) const noexcept {
+        bytes r = *this;
+        return r -= v;
+    }
+
+    [[nodiscard]] constexpr bytes operator*(uint64_t v) const noexcept {
+        bytes r = *this;
+        return r *= v;
+    }
+
+    constexpr bytes& operator+=(uint64_t v) noexcept {
+        detail::wide_words<N> b{};
+        b[0] = v;
+        auto a = detail::load_words<N>(data_);
+        detail::add_words(a, b);
+        detail::store_words<N>(data_, a);
+        return *this;
+    }
+
+    constexpr bytes& operator-=(uint64_t v) noexcept {
+        detail::wide_words<N> b{};
+        b[0] = v;
+        auto a = detail::load_words<N>(data_);
+        detail::sub_words(a, b);
+        detail::store_words<N>(data_, a);
+        return *this;
+    }
+
+    constexpr bytes& operator*=(uint64_t v) noexcept {
+        auto a = detail::load_words<N>(data_);
+        detail::mul_words_scalar(a, v);
+        detail::store_words<N>(data_, a);
+        return *this;
+    }
+
+    constexpr bytes& operator++() noexcept { return *this += 1; }
+    constexpr bytes& operator--() noexcept { return *this -= 1; }
+
+    constexpr bytes operator++(int) noexcept {
+        bytes t = *this;
+        *this += 1;
+        return t;
+    }
+
+    constexpr bytes operator--(int) noexcept {
+        bytes t = *this;
+        *this -= 1;
+        return t;
+    }
+
+    /**
+     * @brief Bagi dengan integer kecil
+     * @param d Pembagi (harus != 0)
+     * @return {quotient, remainder}
+     */
+    [[nodiscard]] constexpr std::pair<bytes, uint32_t> divmod(uint32_t d) const noexcept {
+        auto a = detail::load_words<N>(data_);
+        const uint32_t rem = detail::div_words_small(a, d);
+        bytes q;
+        detail::store_words<N>(q.data_, a);
+        return {q, rem};
+    }
+
+    [[nodiscard]] constexpr bytes operator/(uint32_t d) const noexcept { return divmod(d).first; }
+    [[nodiscard]] constexpr uint32_t operator%(uint32_t d) const noexcept { return divmod(d).second; }
+    constexpr bytes& operator/=(uint32_t d) noexcept { return *this = divmod(d).first; }
+
+    /**
+     * @brief Perbandingan sebagai unsigned integer (bukan urutan byte leksikografis)
+     * @note operator<=> membandingkan byte dari index 0 (leksikografis)
+     */
+    [[nodiscard]] constexpr std::strong_ordering numeric_compare(const bytes& o) const noexcept {
+        return detail::compare_numeric_kernel(data_, o.data_, N);
     }
 
     // ============= Conversion =============
@@ -423,11 +1328,523 @@ public:
     // ============= Comparison =============
 
     [[nodiscard]] constexpr bool operator==(const bytes&) const noexcept = default;
-    [[nodiscard]] constexpr auto operator<=>(const bytes&) const noexcept = default;
+
+    /**
+     * @brief Urutan leksikografis byte dari index 0 (sama dengan memcmp)
+     * @note Bukan urutan numerik; gunakan numeric_compare / numeric_less,
+     *       atau to_key() agar urutan memcmp sama dengan urutan numerik
+     */
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const bytes& o) const noexcept {
+        return detail::compare_lex_kernel(data_, o.data_, N);
+    }
+
+    // ============= Sort Key =============
+
+    /**
+     * @brief Key big-endian: urutan memcmp / operator<=> dari key sama dengan
+     *        urutan numerik nilai aslinya
+     * @example
+     * ```cpp
+     * std::vector<bytes<16>> keys = ...;
+     * for (auto& k : keys) k = k.to_key();
+     * std::sort(keys.begin(), keys.end()); // urutan numerik
+     * ```
+     */
+    [[nodiscard]] constexpr bytes to_key() const noexcept { return reverse(); }
+
+    /** @brief Kebalikan dari to_key() */
+    [[nodiscard]] static constexpr bytes from_key(const bytes& key) noexcept { return key.reverse(); }
 };
 
 // Deduction guide
 template <size_t N>
 bytes(const unsigned char (&)[N]) -> bytes<N>;
 
+/**
+ * @brief Comparator urutan numerik (bytes<N> sebagai unsigned little-endian)
+ * @example std::sort(v.begin(), v.end(), numeric_less{});
+ */
+struct numeric_less {
+    template <size_t N>
+    [[nodiscard]] constexpr bool operator()(const bytes<N>& a, const bytes<N>& b) const noexcept {
+        return a.numeric_compare(b) < 0;
+    }
+};
+
+// ============= Rank Directory =============
+
+/**
+ * @brief Direktori rank precomputed untuk bitmap bytes<N> yang besar
+ *
+ * Menyimpan jumlah kumulatif bit set per blok 512 bit (satu cache line),
+ * sehingga rank() O(1) dan select() O(log blok) + scan maksimal 8 word.
+ *
+ * @note Menyimpan pointer ke bitmap: bitmap harus hidup lebih lama, dan
+ *       rebuild() wajib dipanggil setelah bitmap dimodifikasi
+ * @example
+ * ```cpp
+ * bytes<4096> bm;
+ * // ... set bits ...
+ * rank_directory dir(bm);
+ * auto r = dir.rank(10000);
+ * auto p = dir.select(42);
+ * ```
+ */
+template <size_t N>
+class rank_directory {
+public:
+    using size_type = size_t;
+
+    static constexpr size_type block_bits = 512;
+    static constexpr size_type block_words = block_bits / 64;
+    static constexpr size_type block_count = (N * 8 + block_bits - 1) / block_bits;
+    static constexpr size_type npos = bytes<N>::npos;
+
+private:
+    const bytes<N>* bits_;
+    uint32_t counts_[block_count + 1]{};
+
+public:
+    constexpr explicit rank_directory(const bytes<N>& bits) noexcept : bits_(&bits) { rebuild(); }
+
+    /** @brief Hitung ulang direktori dari isi bitmap saat ini */
+    constexpr void rebuild() noexcept {
+        const uint8_t* p = bits_->data();
+        uint32_t acc = 0;
+        for (size_type b = 0; b < block_count; ++b) {
+            counts_[b] = acc;
+            const size_type first = b * block_bits;
+            acc += static_cast<uint32_t>(detail::count_range_kernel(p, N, first, first + block_bits));
+        }
+        counts_[block_count] = acc;
+    }
+
+    [[nodiscard]] constexpr const bytes<N>& bitmap() const noexcept { return *bits_; }
+
+    /** @brief Total bit set (O(1)) */
+    [[nodiscard]] constexpr size_type popcount() const noexcept { return counts_[block_count]; }
+
+    /** @brief Jumlah bit set di [0, pos) */
+    [[nodiscard]] constexpr size_type rank(size_type pos) const noexcept {
+        if (pos >= N * 8) return popcount();
+        const size_type b = pos / block_bits;
+        return counts_[b] + detail::count_range_kernel(bits_->data(), N, b * block_bits, pos);
+    }
+
+    /** @brief Posisi bit set ke-k (0-based), atau npos */
+    [[nodiscard]] constexpr size_type select(size_type k) const noexcept {
+        if (k >= popcount()) return npos;
+        // Blok terakhir dengan counts_[b] <= k
+        const uint32_t* it = std::upper_bound(counts_, counts_ + block_count, static_cast<uint32_t>(k));
+        const size_type b = static_cast<size_type>(it - counts_) - 1;
+        return detail::select_kernel(bits_->data(), N, k - counts_[b], b * block_words);
+    }
+};
+
+template <size_t N>
+rank_directory(const bytes<N>&) -> rank_directory<N>;
+
+// ============= Runtime Bytes API =============
+
+/**
+ * @brief Buffer byte contiguous: data() -> const uint8_t*, size() -> jumlah byte
+ * @note Dipenuhi bytes<N>, dynamic_bytes, bytes_view, bytes_span, std::vector<uint8_t>
+ */
+template <typename B>
+concept byte_buffer = requires(const B& b) {
+    { b.data() } -> std::convertible_to<const uint8_t*>;
+    { b.size() } -> std::convertible_to<size_t>;
+};
+
+namespace detail {
+
+/**
+ * @brief API read-only bytes untuk buffer runtime-sized (CRTP)
+ *
+ * Derived menyediakan data() dan size(); semua query memakai kernel yang sama
+ * dengan bytes<N>.
+ */
+template <typename D>
+class bytes_query {
+protected:
+    [[nodiscard]] constexpr const uint8_t* cdata() const noexcept { return static_cast<const D&>(*this).data(); }
+    [[nodiscard]] constexpr size_t csize() const noexcept { return static_cast<const D&>(*this).size(); }
+
+public:
+    /** @brief Hasil find_* / select jika tidak ada bit yang cocok */
+    static constexpr size_t npos = bit_npos;
+
+    [[nodiscard]] constexpr size_t bit_size() const noexcept { return csize() * 8; }
+
+    // ============= Bit Query =============
+
+    [[nodiscard]] constexpr bool test_bit(size_t pos) const noexcept {
+        return pos < bit_size() && (cdata()[pos / 8] & (1u << (pos % 8))) != 0;
+    }
+
+    [[nodiscard]] constexpr size_t popcount() const noexcept { return popcount_kernel(cdata(), csize()); }
+
+    [[nodiscard]] constexpr size_t find_first_set() const noexcept { return find_next_set_kernel(cdata(), csize(), 0); }
+    [[nodiscard]] constexpr size_t find_last_set() const noexcept { return find_last_set_kernel(cdata(), csize()); }
+
+    [[nodiscard]] constexpr size_t find_next_set(size_t pos) const noexcept {
+        return find_next_set_kernel(cdata(), csize(), pos);
+    }
+
+    [[nodiscard]] constexpr size_t count_range(size_t first, size_t last) const noexcept {
+        return count_range_kernel(cdata(), csize(), first, last);
+    }
+
+    [[nodiscard]] constexpr size_t rank(size_t pos) const noexcept { return count_range_kernel(cdata(), csize(), 0, pos); }
+    [[nodiscard]] constexpr size_t select(size_t k) const noexcept { return select_kernel(cdata(), csize(), k); }
+    [[nodiscard]] constexpr set_bits_view set_bits() const noexcept { return set_bits_view(cdata(), csize()); }
+
+    // ============= Conversion =============
+
+    /** @brief Integer dari byte terendah (little-endian) */
+    template <typename IntT>
+    requires std::is_integral_v<IntT>
+    [[nodiscard]] constexpr IntT to_int() const noexcept {
+        IntT r = 0;
+        const size_t copy = sizeof(IntT) < csize() ? sizeof(IntT) : csize();
+        for (size_t i = 0; i < copy; ++i) r |= static_cast<IntT>(cdata()[i]) << (i * 8);
+        return r;
+    }
+
+    /** @brief Integer dengan buffer diinterpretasi dalam endian source_endian */
+    template <typename IntT>
+    requires std::is_integral_v<IntT>
+    [[nodiscard]] constexpr IntT to_int(endian_t source_endian) const noexcept {
+        if (source_endian == native_endian) return to_int<IntT>();
+        IntT r = 0;
+        const size_t n = csize();
+        const size_t copy = sizeof(IntT) < n ? sizeof(IntT) : n;
+        for (size_t i = 0; i < copy; ++i) r |= static_cast<IntT>(cdata()[n - 1 - i]) << (i * 8);
+        return r;
+    }
+
+    /** @brief Salin ke bytes<N> (dipotong / zero-extended) */
+    template <size_t N>
+    [[nodiscard]] constexpr bytes<N> to_bytes() const noexcept { return bytes<N>(cdata(), csize()); }
+
+    // ============= Comparison =============
+
+    /** @brief Sama jika ukuran dan seluruh isi sama */
+    template <byte_buffer B>
+    [[nodiscard]] friend constexpr bool operator==(const D& a, const B& b) noexcept {
+        const size_t n = a.size();
+        if (n != static_cast<size_t>(b.size())) return false;
+        const uint8_t* x = a.data();
+        const uint8_t* y = b.data();
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i)
+                if (x[i] != y[i]) return false;
+            return true;
+        }
+        return n == 0 || std::memcmp(x, y, n) == 0;
+    }
+};
+
+/**
+ * @brief API mutable bytes untuk buffer runtime-sized (CRTP)
+ *
+ * Operasi biner dengan buffer lain bekerja pada ukuran buffer ini; operand
+ * yang lebih pendek dianggap zero-extended, yang lebih panjang dipotong.
+ */
+template <typename D>
+class bytes_modify : public bytes_query<D> {
+protected:
+    [[nodiscard]] constexpr uint8_t* mdata() noexcept { return static_cast<D&>(*this).data(); }
+    using bytes_query<D>::csize;
+
+    template <typename Op, typename B>
+    constexpr D& apply(const B& o) noexcept {
+        const size_t n = csize();
+        const size_t m = static_cast<size_t>(o.size()) < n ? static_cast<size_t>(o.size()) : n;
+        bitwise_kernel<Op>(mdata(), mdata(), o.data(), m);
+        if constexpr (std::is_same_v<Op, bit_and>) {
+            for (size_t i = m; i < n; ++i) mdata()[i] = 0;
+        }
+        return static_cast<D&>(*this);
+    }
+
+public:
+    // ============= Bit Manipulation =============
+
+    constexpr void set_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mdata()[pos / 8] |= static_cast<uint8_t>(1u << (pos % 8));
+    }
+
+    constexpr void clear_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mdata()[pos / 8] &= static_cast<uint8_t>(~(1u << (pos % 8)));
+    }
+
+    constexpr void toggle_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mdata()[pos / 8] ^= static_cast<uint8_t>(1u << (pos % 8));
+    }
+
+    // ============= Compound Assignment =============
+
+    template <byte_buffer B>
+    constexpr D& operator|=(const B& o) noexcept { return apply<bit_or>(o); }
+
+    template <byte_buffer B>
+    constexpr D& operator&=(const B& o) noexcept { return apply<bit_and>(o); }
+
+    template <byte_buffer B>
+    constexpr D& operator^=(const B& o) noexcept { return apply<bit_xor>(o); }
+
+    /** @brief ~ in-place */
+    constexpr D& flip() noexcept {
+        bitwise_kernel<bit_not>(mdata(), mdata(), mdata(), csize());
+        return static_cast<D&>(*this);
+    }
+
+    constexpr D& operator<<=(size_t n) noexcept {
+        shift_left_kernel(mdata(), mdata(), csize(), n);
+        return static_cast<D&>(*this);
+    }
+
+    constexpr D& operator>>=(size_t n) noexcept {
+        shift_right_kernel(mdata(), mdata(), csize(), n);
+        return static_cast<D&>(*this);
+    }
+
+    constexpr D& rotate_left_inplace(size_t n) noexcept {
+        rotate_left_inplace_kernel(mdata(), csize(), n);
+        return static_cast<D&>(*this);
+    }
+
+    constexpr D& rotate_right_inplace(size_t n) noexcept {
+        const size_t bits = this->bit_size();
+        if (bits) rotate_left_inplace_kernel(mdata(), csize(), bits - n % bits);
+        return static_cast<D&>(*this);
+    }
+
+    // ============= Modifiers =============
+
+    constexpr void fill(uint8_t v) noexcept {
+        uint8_t* p = mdata();
+        for (size_t i = 0, n = csize(); i < n; ++i) p[i] = v;
+    }
+
+    /** @brief Nol-kan semua byte (ukuran tidak berubah) */
+    constexpr void clear() noexcept { fill(0); }
+
+    /** @brief Salin isi o (dipotong / sisa di-nol-kan) */
+    template <byte_buffer B>
+    constexpr D& assign(const B& o) noexcept {
+        const size_t n = csize();
+        const size_t m = static_cast<size_t>(o.size()) < n ? static_cast<size_t>(o.size()) : n;
+        uint8_t* p = mdata();
+        const uint8_t* q = o.data();
+        for (size_t i = 0; i < m; ++i) p[i] = q[i];
+        for (size_t i = m; i < n; ++i) p[i] = 0;
+        return static_cast<D&>(*this);
+    }
+
+    // ============= Endian Conversion =============
+
+    /** @brief Reverse bytes in-place */
+    constexpr void swap_bytes() noexcept { std::reverse(mdata(), mdata() + csize()); }
+
+    constexpr void make_little_endian() noexcept {
+        if constexpr (!is_little_endian) swap_bytes();
+    }
+
+    constexpr void make_big_endian() noexcept {
+        if constexpr (!is_big_endian) swap_bytes();
+    }
+
+    /** @brief Convert ke endianness target in-place (runtime) */
+    constexpr void make_endian(endian_t target) noexcept {
+        if (target != native_endian) swap_bytes();
+    }
+};
+
+} // namespace detail
+
+// ============= Bytes Ref =============
+
+/**
+ * @brief Reference non-owning ke N byte di memori eksternal dengan API bytes<N>
+ * @tparam N Jumlah byte
+ * @tparam Const true untuk akses read-only
+ *
+ * Semua operasi in-place (|=, &=, ^=, <<=, set_bit, swap_bytes, ...) menulis
+ * langsung ke memori asal tanpa copy; operasi yang menghasilkan nilai baru
+ * (|, <<, rotate_left, to_big_endian, ...) mengembalikan bytes<N>.
+ *
+ * @note Copy-assignment me-rebind reference (seperti std::span); gunakan
+ *       assign() untuk menyalin isi
+ * @example
+ * ```cpp
+ * uint8_t* pkt = rx_buffer + offset;
+ * bytes_ref<16> hdr(pkt);
+ * hdr &= mask;                 // menulis ke rx_buffer
+ * hdr.set_bit(3);
+ * const_bytes_ref<16> ro(pkt);
+ * auto n = ro.popcount();
+ * ```
+ */
+template <size_t N, bool Const>
+requires (N > 0)
+class basic_bytes_ref
+    : public std::conditional_t<Const, detail::bytes_query<basic_bytes_ref<N, Const>>,
+                                detail::bytes_modify<basic_bytes_ref<N, Const>>> {
+public:
+    // ============= Type Aliases =============
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using pointer = std::conditional_t<Const, const byte_t*, byte_t*>;
+    using const_pointer = const byte_t*;
+    using reference = std::conditional_t<Const, const byte_t&, byte_t&>;
+    using value_bytes = bytes<N>;
+
+    static constexpr size_type byte_count = N;
+    static constexpr size_type bit_count = N * 8;
+
+private:
+    pointer data_;
+
+public:
+    // ============= Constructors =============
+
+    /** @brief Reference ke N byte mulai dari p */
+    constexpr explicit basic_bytes_ref(pointer p) noexcept : data_(p) {}
+
+    constexpr basic_bytes_ref(std::conditional_t<Const, const bytes<N>&, bytes<N>&> b) noexcept
+        : data_(b.data()) {}
+
+    /** @brief bytes_ref<N> -> const_bytes_ref<N> */
+    constexpr basic_bytes_ref(const basic_bytes_ref<N, false>& o) noexcept requires Const
+        : data_(o.data()) {}
+
+    // ============= Element Access =============
+
+    [[nodiscard]] constexpr reference operator[](size_type i) const noexcept { return data_[i]; }
+    [[nodiscard]] constexpr reference front() const noexcept { return data_[0]; }
+    [[nodiscard]] constexpr reference back() const noexcept { return data_[N - 1]; }
+    [[nodiscard]] constexpr pointer data() const noexcept { return data_; }
+
+    [[nodiscard]] static constexpr size_type size() noexcept { return N; }
+    [[nodiscard]] static constexpr bool empty() noexcept { return false; }
+
+    [[nodiscard]] constexpr pointer begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr pointer end() const noexcept { return data_ + N; }
+
+    /** @brief Salin isi ke bytes<N> */
+    [[nodiscard]] constexpr bytes<N> value() const noexcept { return bytes<N>(data_, N); }
+
+    // ============= Bitwise Operations =============
+
+    [[nodiscard]] constexpr bytes<N> operator|(basic_bytes_ref<N, true> o) const noexcept {
+        bytes<N> r;
+        detail::bitwise_kernel<detail::bit_or>(r.data(), data_, o.data(), N);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> operator&(basic_bytes_ref<N, true> o) const noexcept {
+        bytes<N> r;
+        detail::bitwise_kernel<detail::bit_and>(r.data(), data_, o.data(), N);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> operator^(basic_bytes_ref<N, true> o) const noexcept {
+        bytes<N> r;
+        detail::bitwise_kernel<detail::bit_xor>(r.data(), data_, o.data(), N);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> operator~() const noexcept {
+        bytes<N> r;
+        detail::bitwise_kernel<detail::bit_not>(r.data(), data_, data_, N);
+        return r;
+    }
+
+    // ============= Shift & Rotation =============
+
+    [[nodiscard]] constexpr bytes<N> operator<<(size_type bits) const noexcept {
+        bytes<N> r;
+        detail::shift_left_kernel(r.data(), data_, N, bits);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> operator>>(size_type bits) const noexcept {
+        bytes<N> r;
+        detail::shift_right_kernel(r.data(), data_, N, bits);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> rotate_left(size_type n) const noexcept {
+        bytes<N> r;
+        detail::rotate_left_kernel(r.data(), data_, N, n);
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> rotate_right(size_type n) const noexcept {
+        bytes<N> r;
+        detail::rotate_left_kernel(r.data(), data_, N, bit_count - n % bit_count);
+        return r;
+    }
+
+    /** @brief Rotate-left in-place (salinan sumber di stack, satu pass funnel) */
+    constexpr basic_bytes_ref& rotate_left_inplace(size_type n) noexcept requires (!Const) {
+        const bytes<N> src(data_, N);
+        detail::rotate_left_kernel(data_, src.data(), N, n);
+        return *this;
+    }
+
+    constexpr basic_bytes_ref& rotate_right_inplace(size_type n) noexcept requires (!Const) {
+        const bytes<N> src(data_, N);
+        detail::rotate_left_kernel(data_, src.data(), N, bit_count - n % bit_count);
+        return *this;
+    }
+
+    // ============= Endian Conversion =============
+
+    [[nodiscard]] constexpr bytes<N> reverse() const noexcept {
+        bytes<N> r;
+        for (size_type i = 0; i < N; ++i) r[i] = data_[N - 1 - i];
+        return r;
+    }
+
+    [[nodiscard]] constexpr bytes<N> to_endian(endian_t target) const noexcept {
+        return target == native_endian ? value() : reverse();
+    }
+
+    [[nodiscard]] constexpr bytes<N> from_endian(endian_t source) const noexcept { return to_endian(source); }
+    [[nodiscard]] constexpr bytes<N> to_little_endian() const noexcept { return to_endian(endian_t::little); }
+    [[nodiscard]] constexpr bytes<N> to_big_endian() const noexcept { return to_endian(endian_t::big); }
+    [[nodiscard]] constexpr bytes<N> to_network() const noexcept { return to_big_endian(); }
+    [[nodiscard]] constexpr bytes<N> from_little_endian() const noexcept { return to_little_endian(); }
+    [[nodiscard]] constexpr bytes<N> from_big_endian() const noexcept { return to_big_endian(); }
+    [[nodiscard]] constexpr bytes<N> from_network() const noexcept { return to_big_endian(); }
+
+    // ============= Comparison =============
+
+    /** @brief Urutan leksikografis byte (sama dengan bytes<N>::operator<=>) */
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(basic_bytes_ref<N, true> o) const noexcept {
+        for (size_type i = 0; i < N; ++i)
+            if (data_[i] != o.data()[i]) return data_[i] <=> o.data()[i];
+        return std::strong_ordering::equal;
+    }
+};
+
+template <size_t N>
+using bytes_ref = basic_bytes_ref<N, false>;
+
+template <size_t N>
+using const_bytes_ref = basic_bytes_ref<N, true>;
+
+template <size_t N>
+basic_bytes_ref(bytes<N>&) -> basic_bytes_ref<N, false>;
+
+template <size_t N>
+basic_bytes_ref(const bytes<N>&) -> basic_bytes_ref<N, true>;
+
 } // namespace zuu
+
+template <>
+inline constexpr bool std::ranges::enable_borrowed_range<zuu::set_bits_view> = true;
@@ -7,11 +7,18 @@
  * 
  * Menyediakan akses low-level ke representasi memori dari tipe apapun.
  * Dioptimasi untuk zero-overhead abstraction.
+ *
+ * - composer<T>: satu value sebagai bytes
+ * - composer_span<T>: array T sebagai bytes, konversi endian bulk in-place
+ * - to_wire / from_wire: bentuk wire packed tanpa padding (layout.hpp)
  */
 
 #include "endian.hpp"
+#include "layout.hpp"
+#include <array>
 #include <cstdint>
 #include <cstring>
+#include <ranges>
 #include <span>
 #include <type_traits>
 #include <utility>
@@ -126,6 +133,24 @@ public:
     [[nodiscard]] constexpr explicit operator T() const noexcept { return value_; }
 
     // ============= Endian Conversion =============
+    //
+    // Tersedia untuk scalar (integral, enum, float, double, __int128) dan
+    // struct dengan field_list<T> (swap per field, lihat layout.hpp).
+
+private:
+    /**
+     * @brief Salinan *this, di-swap in-place bila swap
+     * @note Swap langsung di salinan (bukan lewat temporary T) agar struct
+     *       besar tidak dirakit ulang di stack lalu dibaca dengan load lebar
+     */
+    [[nodiscard]] constexpr composer swapped_if(bool swap) const noexcept
+    requires endian_convertible<T> {
+        composer result(*this);
+        if (swap) result.swap_bytes();
+        return result;
+    }
+
+public:
 
     /**
      * @brief Convert value ke little-endian byte order
@@ -133,8 +158,8 @@ public:
      * @note No-op pada little-endian systems
      */
     [[nodiscard]] constexpr composer to_little_endian() const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::to_little_endian(value_));
+    requires endian_convertible<T> {
+        return swapped_if(!is_little_endian);
     }
 
     /**
@@ -143,8 +168,8 @@ public:
      * @note No-op pada big-endian systems
      */
     [[nodiscard]] constexpr composer to_big_endian() const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::to_big_endian(value_));
+    requires endian_convertible<T> {
+        return swapped_if(!is_big_endian);
     }
 
     /**
@@ -152,7 +177,7 @@ public:
      * @return composer dengan bytes dalam network order
      */
     [[nodiscard]] constexpr composer to_network() const noexcept 
-    requires std::integral<T> {
+    requires endian_convertible<T> {
         return to_big_endian();
     }
 
@@ -161,8 +186,8 @@ public:
      * @return composer dengan native byte order
      */
     [[nodiscard]] constexpr composer from_little_endian() const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::from_little_endian(value_));
+    requires endian_convertible<T> {
+        return swapped_if(!is_little_endian);
     }
 
     /**
@@ -170,8 +195,8 @@ public:
      * @return composer dengan native byte order
      */
     [[nodiscard]] constexpr composer from_big_endian() const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::from_big_endian(value_));
+    requires endian_convertible<T> {
+        return swapped_if(!is_big_endian);
     }
 
     /**
@@ -179,7 +204,7 @@ public:
      * @return composer dengan native byte order
      */
     [[nodiscard]] constexpr composer from_network() const noexcept 
-    requires std::integral<T> {
+    requires endian_convertible<T> {
         return from_big_endian();
     }
 
@@ -189,8 +214,8 @@ public:
      * @return composer dengan bytes dalam target order
      */
     [[nodiscard]] constexpr composer to_endian(endian_t target) const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::to_endian(value_, target));
+    requires endian_convertible<T> {
+        return swapped_if(target != native_endian);
     }
 
     /**
@@ -198,23 +223,54 @@ public:
      * @return composer dengan bytes terbalik
      */
     [[nodiscard]] constexpr composer byte_swapped() const noexcept 
-    requires std::integral<T> {
-        return composer(zuu::byte_swap(value_));
+    requires endian_convertible<T> {
+        return swapped_if(true);
     }
 
     /**
      * @brief Swap byte order in-place
      */
     constexpr void swap_bytes() noexcept 
-    requires std::integral<T> {
-        value_ = zuu::byte_swap(value_);
+    requires endian_convertible<T> {
+        if constexpr (endian_struct<T>) byte_swap_fields(value_);
+        else value_ = zuu::byte_swap(value_);
+    }
+
+    // ============= Wire Form (packed) =============
+    //
+    // Untuk struct dengan wire_layout<T> (default: field_list<T>, big-endian).
+    // Bentuk wire tanpa padding; lihat wire_pack / wire_unpack di layout.hpp.
+
+    /** @brief Bentuk wire packed: std::array<uint8_t, wire_size<T>> */
+    [[nodiscard]] auto to_wire() const noexcept
+    requires wire_struct<T> {
+        std::array<uint8_t, wire_size<T>> out;
+        wire_pack(value_, out.data());
+        return out;
+    }
+
+    /** @brief Tulis bentuk wire packed ke out (wire_size<T> byte, unaligned) */
+    void to_wire(void* out) const noexcept
+    requires wire_struct<T> {
+        wire_pack(value_, out);
+    }
+
+    /**
+     * @brief Parse bentuk wire packed (wire_size<T> byte, unaligned)
+     * @note Padding dan field di luar wire_layout<T> bernilai nol
+     */
+    [[nodiscard]] static composer from_wire(const void* in) noexcept
+    requires wire_struct<T> {
+        return composer(wire_unpack<T>(in));
     }
 
     // ============= Endian for Non-Integral (via raw bytes) =============
 
     /**
-     * @brief Reverse raw bytes (for non-integral types)
+     * @brief Reverse seluruh raw bytes object
      * @return composer dengan bytes terbalik
+     * @note Bukan konversi endian untuk struct multi-field; gunakan field_list<T>
+     *       dan to_big_endian() / to_network()
      */
     [[nodiscard]] constexpr composer reversed() const noexcept {
         composer result;
@@ -240,4 +296,156 @@ public:
 template <typename T>
 composer(T) -> composer<T>;
 
+// ============= composer_span =============
+
+/**
+ * @brief View zero-copy atas array T sebagai bytes, dengan konversi endian bulk
+ * @tparam T Tipe elemen (const untuk view read-only)
+ *
+ * Konversi endian dilakukan in-place untuk seluruh array sekaligus:
+ * scalar lewat bulk_byte_swap (endian.hpp), struct dengan field_list<T> lewat
+ * bulk_byte_swap_fields (layout.hpp). Tidak ada composer per elemen dan
+ * tidak ada salinan perantara.
+ *
+ * @example
+ * ```cpp
+ * std::vector<header> records = ...;
+ * composer_span view(records);
+ * send(view.to_network().as_bytes());    // swap in-place lalu kirim
+ *
+ * auto in = composer_span<header>::from_bytes(buffer);
+ * in.from_network();                      // buffer kini berisi header native
+ * ```
+ */
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+class composer_span {
+public:
+    // ============= Type Aliases =============
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using byte_type = std::conditional_t<std::is_const_v<T>, const uint8_t, uint8_t>;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = typename std::span<T>::iterator;
+
+    // ============= Constructors =============
+
+    constexpr composer_span() noexcept = default;
+
+    /** @brief View dari pointer + jumlah elemen */
+    constexpr composer_span(T* data, size_type count) noexcept : values_(data, count) {}
+
+    /** @brief View dari span / vector / array (contiguous range) */
+    template <std::ranges::contiguous_range R>
+    requires std::is_constructible_v<std::span<T>, R&&>
+    constexpr composer_span(R&& range) noexcept : values_(std::forward<R>(range)) {}
+
+    /**
+     * @brief View buffer byte sebagai array T (zero-copy)
+     * @note bytes.data() harus ter-align ke alignof(T); sisa byte < sizeof(T) diabaikan
+     */
+    [[nodiscard]] static composer_span from_bytes(std::span<byte_type> bytes) noexcept {
+        return composer_span(reinterpret_cast<T*>(bytes.data()), bytes.size() / sizeof(T));
+    }
+
+    // ============= Element Access =============
+
+    [[nodiscard]] constexpr std::span<T> values() const noexcept { return values_; }
+    [[nodiscard]] constexpr pointer data() const noexcept { return values_.data(); }
+    [[nodiscard]] constexpr size_type size() const noexcept { return values_.size(); }
+    [[nodiscard]] constexpr size_type size_bytes() const noexcept { return values_.size_bytes(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return values_.empty(); }
+    [[nodiscard]] constexpr reference operator[](size_type i) const noexcept { return values_[i]; }
+    [[nodiscard]] constexpr iterator begin() const noexcept { return values_.begin(); }
+    [[nodiscard]] constexpr iterator end() const noexcept { return values_.end(); }
+
+    /** @brief Sub-view [offset, offset + count) */
+    [[nodiscard]] constexpr composer_span subspan(size_type offset,
+                                                  size_type count = std::dynamic_extent) const noexcept {
+        return composer_span(values_.subspan(offset, count));
+    }
+
+    // ============= Byte Access (Zero-copy) =============
+
+    /** @brief Seluruh array sebagai bytes (writable jika T tidak const) */
+    [[nodiscard]] std::span<byte_type> as_bytes() const noexcept {
+        return std::span<byte_type>(reinterpret_cast<byte_type*>(values_.data()), values_.size_bytes());
+    }
+
+    // ============= Endian Conversion (in-place) =============
+    //
+    // Semua method mengubah elemen di tempat dan mengembalikan *this agar bisa
+    // dirangkai dengan as_bytes().
+
+    /** @brief Native -> little-endian in-place (no-op pada little-endian) */
+    constexpr composer_span to_little_endian() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        if constexpr (!is_little_endian) swap_all();
+        return *this;
+    }
+
+    /** @brief Native -> big-endian in-place (no-op pada big-endian) */
+    constexpr composer_span to_big_endian() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        if constexpr (!is_big_endian) swap_all();
+        return *this;
+    }
+
+    /** @brief Native -> network order (big-endian) in-place */
+    constexpr composer_span to_network() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        return to_big_endian();
+    }
+
+    /** @brief Little-endian -> native in-place */
+    constexpr composer_span from_little_endian() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        return to_little_endian();
+    }
+
+    /** @brief Big-endian -> native in-place */
+    constexpr composer_span from_big_endian() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        return to_big_endian();
+    }
+
+    /** @brief Network order -> native in-place */
+    constexpr composer_span from_network() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        return to_big_endian();
+    }
+
+    /** @brief Native <-> endianness runtime in-place */
+    constexpr composer_span to_endian(endian_t target) const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        if (target != native_endian) swap_all();
+        return *this;
+    }
+
+    /** @brief Swap byte order setiap elemen in-place */
+    constexpr composer_span swap_bytes() const noexcept
+    requires (!std::is_const_v<T> && endian_convertible<value_type>) {
+        swap_all();
+        return *this;
+    }
+
+private:
+    std::span<T> values_;
+
+    constexpr void swap_all() const noexcept {
+        if constexpr (endian_struct<value_type>) {
+            bulk_byte_swap_fields(values_);
+        } else if constexpr (endian_swappable<value_type>) {
+            bulk_byte_swap(values_);
+        } else {
+            for (auto& v : values_) v = zuu::byte_swap(v);
+        }
+    }
+};
+
+template <std::ranges::contiguous_range R>
+composer_span(R&&) -> composer_span<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
 } // namespace zuu
@@ -0,0 +1,432 @@
+#pragma once
+
+/**
+ * @file dynamic_bytes.hpp
+ * @brief Byte array runtime-sized dan view non-owning dengan API bytes<N>
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - bytes_view: view read-only (pointer + size)
+ * - bytes_span: view mutable, operasi in-place langsung ke memori asal
+ * - basic_dynamic_bytes<Alloc>: storage owning, aligned 64-byte, allocator pluggable
+ *
+ * Semua operasi memakai kernel yang sama dengan bytes<N> (SIMD bitwise,
+ * shift per word, bit scan). bytes<N> bisa dilihat sebagai bytes_view /
+ * bytes_span tanpa copy.
+ */
+
+#include "bytes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+namespace detail {
+
+/** @brief Unit alokasi dynamic_bytes: satu cache line */
+struct alignas(64) byte_block {
+    uint8_t b[64];
+};
+
+} // namespace detail
+
+// ============= Views =============
+
+/**
+ * @brief View read-only atas byte contiguous
+ * @example
+ * ```cpp
+ * bytes<64> mask;
+ * bytes_view v(mask);          // zero-copy
+ * auto first = v.find_first_set();
+ * ```
+ */
+class bytes_view : public detail::bytes_query<bytes_view> {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using const_pointer = const byte_t*;
+
+private:
+    const byte_t* data_ = nullptr;
+    size_type size_ = 0;
+
+public:
+    constexpr bytes_view() noexcept = default;
+    constexpr bytes_view(const byte_t* data, size_type size) noexcept : data_(data), size_(size) {}
+
+    /** @brief View atas buffer lain (bytes<N>, dynamic_bytes, bytes_span, vector, ...) */
+    template <byte_buffer B>
+    requires (!std::is_same_v<std::remove_cvref_t<B>, bytes_view>)
+    constexpr bytes_view(const B& b) noexcept
+        : data_(b.data()), size_(static_cast<size_type>(b.size())) {}
+
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return data_; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr byte_t operator[](size_type i) const noexcept { return data_[i]; }
+    [[nodiscard]] constexpr const_pointer begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr const_pointer end() const noexcept { return data_ + size_; }
+
+    /** @brief Sub-view [offset, offset + count), dipotong ke ukuran view */
+    [[nodiscard]] constexpr bytes_view subview(size_type offset, size_type count = detail::bit_npos) const noexcept {
+        if (offset > size_) offset = size_;
+        if (count > size_ - offset) count = size_ - offset;
+        return bytes_view(data_ + offset, count);
+    }
+};
+
+/**
+ * @brief View mutable atas byte contiguous
+ *
+ * Operasi in-place (|=, <<=, set_bit, swap_bytes, ...) menulis langsung ke
+ * memori asal.
+ */
+class bytes_span : public detail::bytes_modify<bytes_span> {
+public:
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using pointer = byte_t*;
+
+private:
+    byte_t* data_ = nullptr;
+    size_type size_ = 0;
+
+public:
+    constexpr bytes_span() noexcept = default;
+    constexpr bytes_span(byte_t* data, size_type size) noexcept : data_(data), size_(size) {}
+
+    template <size_t N>
+    constexpr bytes_span(bytes<N>& b) noexcept : data_(b.data()), size_(N) {}
+
+    [[nodiscard]] constexpr pointer data() const noexcept { return data_; }
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] constexpr byte_t& operator[](size_type i) const noexcept { return data_[i]; }
+    [[nodiscard]] constexpr pointer begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr pointer end() const noexcept { return data_ + size_; }
+
+    [[nodiscard]] constexpr bytes_span subspan(size_type offset, size_type count = detail::bit_npos) const noexcept {
+        if (offset > size_) offset = size_;
+        if (count > size_ - offset) count = size_ - offset;
+        return bytes_span(data_ + offset, count);
+    }
+};
+
+// ============= Dynamic Bytes =============
+
+/**
+ * @brief Byte array dengan ukuran runtime
+ * @tparam Alloc Allocator (di-rebind ke blok 64-byte), mis. std::allocator
+ *         atau std::pmr::polymorphic_allocator untuk arena
+ *
+ * Storage dialokasikan per blok 64-byte sehingga data() selalu aligned
+ * 64-byte (selama allocator menghormati alignof). API sama dengan bytes<N>:
+ * operator bitwise, shift, rotate, bit manipulation, bit scan dan endian.
+ *
+ * @note Operasi biner dengan buffer berbeda ukuran: hasil berukuran operand
+ *       kiri; operand kanan dianggap zero-extended / dipotong
+ * @note clear() me-nol-kan isi seperti bytes<N>::clear(); ukuran diubah via resize()
+ * @example
+ * ```cpp
+ * dynamic_bytes mask(cfg.mask_bytes);
+ * mask.set_bit(17);
+ * mask |= other;
+ * for (size_t i : mask.set_bits()) { ... }
+ *
+ * std::pmr::monotonic_buffer_resource arena;
+ * pmr::dynamic_bytes bloom(4096, &arena);
+ * ```
+ */
+template <typename Alloc = std::allocator<uint8_t>>
+class basic_dynamic_bytes : public detail::bytes_modify<basic_dynamic_bytes<Alloc>> {
+public:
+    // ============= Type Aliases =============
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using pointer = byte_t*;
+    using const_pointer = const byte_t*;
+    using reference = byte_t&;
+    using const_reference = const byte_t&;
+    using allocator_type = Alloc;
+
+    static constexpr size_type alignment = alignof(detail::byte_block);
+
+private:
+    using block = detail::byte_block;
+    using block_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<block>;
+    using block_traits = std::allocator_traits<block_alloc>;
+
+    [[no_unique_address]] block_alloc alloc_;
+    block* blocks_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0; // Dalam blok
+
+    /** @brief ceil(n / sizeof(block)) tanpa overflow untuk n mendekati SIZE_MAX */
+    [[nodiscard]] static constexpr size_type blocks_for(size_type n) noexcept {
+        return n / sizeof(block) + (n % sizeof(block) != 0);
+    }
+
+    void release() noexcept {
+        if (blocks_) block_traits::deallocate(alloc_, blocks_, capacity_);
+        blocks_ = nullptr;
+        capacity_ = 0;
+    }
+
+    /** @brief Pastikan kapasitas >= n byte; isi lama dipertahankan */
+    void grow(size_type n) {
+        const size_type need = blocks_for(n);
+        if (need <= capacity_) return;
+        block* fresh = block_traits::allocate(alloc_, need);
+        if (size_) std::memcpy(fresh, blocks_, size_);
+        release();
+        blocks_ = fresh;
+        capacity_ = need;
+    }
+
+    void steal(basic_dynamic_bytes& o) noexcept {
+        blocks_ = std::exchange(o.blocks_, nullptr);
+        size_ = std::exchange(o.size_, 0);
+        capacity_ = std::exchange(o.capacity_, 0);
+    }
+
+public:
+    // ============= Constructors =============
+
+    basic_dynamic_bytes() noexcept(noexcept(Alloc())) = default;
+
+    explicit basic_dynamic_bytes(const Alloc& alloc) noexcept : alloc_(alloc) {}
+
+    /** @brief n byte bernilai nol */
+    explicit basic_dynamic_bytes(size_type n, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        grow(n);
+        if (blocks_) std::memset(blocks_, 0, capacity_ * sizeof(block));
+        size_ = n;
+    }
+
+    /** @brief n byte bernilai fill_value */
+    basic_dynamic_bytes(size_type n, byte_t fill_value, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        grow(n);
+        size_ = n;
+        this->fill(fill_value);
+    }
+
+    basic_dynamic_bytes(const byte_t* data, size_type len, const Alloc& alloc = Alloc()) : alloc_(alloc) {
+        grow(len);
+        if (len) std::memcpy(blocks_, data, len);
+        size_ = len;
+    }
+
+    basic_dynamic_bytes(std::initializer_list<byte_t> init, const Alloc& alloc = Alloc())
+        : basic_dynamic_bytes(init.begin(), init.size(), alloc) {}
+
+    /** @brief Salin dari buffer lain (bytes<N>, bytes_view, vector, ...) */
+    template <byte_buffer B>
+    requires (!std::is_same_v<std::remove_cvref_t<B>, basic_dynamic_bytes>)
+    explicit basic_dynamic_bytes(const B& b, const Alloc& alloc = Alloc())
+        : basic_dynamic_bytes(b.data(), static_cast<size_type>(b.size()), alloc) {}
+
+    basic_dynamic_bytes(const basic_dynamic_bytes& o)
+        : basic_dynamic_bytes(o.data(), o.size(), block_traits::select_on_container_copy_construction(o.alloc_)) {}
+
+    /** @brief Salin dengan allocator tertentu (allocator-extended copy) */
+    basic_dynamic_bytes(const basic_dynamic_bytes& o, const Alloc& alloc)
+        : basic_dynamic_bytes(o.data(), o.size(), alloc) {}
+
+    basic_dynamic_bytes(basic_dynamic_bytes&& o) noexcept : alloc_(std::move(o.alloc_)) { steal(o); }
+
+    basic_dynamic_bytes& operator=(const basic_dynamic_bytes& o) {
+        if (this == &o) return *this;
+        if constexpr (block_traits::propagate_on_container_copy_assignment::value) {
+            if (alloc_ != o.alloc_) {
+                release();
+                size_ = 0;
+            }
+            alloc_ = o.alloc_;
+        }
+        size_ = 0;
+        grow(o.size_);
+        if (o.size_) std::memcpy(blocks_, o.blocks_, o.size_);
+        size_ = o.size_;
+        return *this;
+    }
+
+    basic_dynamic_bytes& operator=(basic_dynamic_bytes&& o) noexcept(
+        block_traits::propagate_on_container_move_assignment::value || block_traits::is_always_equal::value) {
+        if (this == &o) return *this;
+        if constexpr (block_traits::propagate_on_container_move_assignment::value) {
+            release();
+            alloc_ = std::move(o.alloc_);
+            steal(o);
+        } else {
+            if (alloc_ == o.alloc_) {
+                release();
+                steal(o);
+            } else {
+                *this = static_cast<const basic_dynamic_bytes&>(o);
+            }
+        }
+        return *this;
+    }
+
+    ~basic_dynamic_bytes() { release(); }
+
+    // ============= Element Access =============
+
+    [[nodiscard]] reference operator[](size_type i) noexcept { return data()[i]; }
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept { return data()[i]; }
+    [[nodiscard]] reference front() noexcept { return data()[0]; }
+    [[nodiscard]] const_reference front() const noexcept { return data()[0]; }
+    [[nodiscard]] reference back() noexcept { return data()[size_ - 1]; }
+    [[nodiscard]] const_reference back() const noexcept { return data()[size_ - 1]; }
+    [[nodiscard]] pointer data() noexcept { return reinterpret_cast<pointer>(blocks_); }
+    [[nodiscard]] const_pointer data() const noexcept { return reinterpret_cast<const_pointer>(blocks_); }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_ * sizeof(block); }
+    [[nodiscard]] allocator_type get_allocator() const noexcept { return allocator_type(alloc_); }
+
+    /** @brief Ubah ukuran; byte baru bernilai nol */
+    void resize(size_type n) {
+        grow(n);
+        if (n > size_) std::memset(data() + size_, 0, n - size_);
+        size_ = n;
+    }
+
+    void reserve(size_type n) { grow(n); }
+
+    void shrink_to_fit() {
+        const size_type need = blocks_for(size_);
+        if (need == capacity_) return;
+        block* fresh = need ? block_traits::allocate(alloc_, need) : nullptr;
+        if (size_) std::memcpy(fresh, blocks_, size_);
+        release();
+        blocks_ = fresh;
+        capacity_ = need;
+    }
+
+    // ============= Iterators =============
+
+    [[nodiscard]] pointer begin() noexcept { return data(); }
+    [[nodiscard]] pointer end() noexcept { return data() + size_; }
+    [[nodiscard]] const_pointer begin() const noexcept { return data(); }
+    [[nodiscard]] const_pointer end() const noexcept { return data() + size_; }
+    [[nodiscard]] const_pointer cbegin() const noexcept { return data(); }
+    [[nodiscard]] const_pointer cend() const noexcept { return data() + size_; }
+
+    // ============= Views =============
+
+    [[nodiscard]] bytes_view view() const noexcept { return bytes_view(data(), size_); }
+    [[nodiscard]] bytes_span span() noexcept { return bytes_span(data(), size_); }
+    operator bytes_view() const noexcept { return view(); }
+    operator bytes_span() noexcept { return span(); }
+
+    // ============= Bitwise Operations =============
+
+    template <byte_buffer B>
+    [[nodiscard]] basic_dynamic_bytes operator|(const B& o) const {
+        basic_dynamic_bytes r(*this, get_allocator());
+        return std::move(r |= o);
+    }
+
+    template <byte_buffer B>
+    [[nodiscard]] basic_dynamic_bytes operator&(const B& o) const {
+        basic_dynamic_bytes r(*this, get_allocator());
+        return std::move(r &= o);
+    }
+
+    template <byte_buffer B>
+    [[nodiscard]] basic_dynamic_bytes operator^(const B& o) const {
+        basic_dynamic_bytes r(*this, get_allocator());
+        return std::move(r ^= o);
+    }
+
+    [[nodiscard]] basic_dynamic_bytes operator~() const {
+        basic_dynamic_bytes r(size_, get_allocator());
+        detail::bitwise_kernel<detail::bit_not>(r.data(), data(), data(), size_);
+        return r;
+    }
+
+    // ============= Shift & Rotation =============
+
+    [[nodiscard]] basic_dynamic_bytes operator<<(size_type bits) const {
+        basic_dynamic_bytes r(size_, get_allocator());
+        detail::shift_left_kernel(r.data(), data(), size_, bits);
+        return r;
+    }
+
+    [[nodiscard]] basic_dynamic_bytes operator>>(size_type bits) const {
+        basic_dynamic_bytes r(size_, get_allocator());
+        detail::shift_right_kernel(r.data(), data(), size_, bits);
+        return r;
+    }
+
+    [[nodiscard]] basic_dynamic_bytes rotate_left(size_type n) const {
+        basic_dynamic_bytes r(size_, get_allocator());
+        if (size_) detail::rotate_left_kernel(r.data(), data(), size_, n);
+        return r;
+    }
+
+    [[nodiscard]] basic_dynamic_bytes rotate_right(size_type n) const {
+        basic_dynamic_bytes r(size_, get_allocator());
+        if (size_) detail::rotate_left_kernel(r.data(), data(), size_, this->bit_size() - n % this->bit_size());
+        return r;
+    }
+
+    // ============= Endian Conversion =============
+
+    [[nodiscard]] basic_dynamic_bytes reverse() const {
+        basic_dynamic_bytes r(*this, get_allocator());
+        r.swap_bytes();
+        return r;
+    }
+
+    [[nodiscard]] basic_dynamic_bytes to_endian(endian_t target) const {
+        basic_dynamic_bytes r(*this, get_allocator());
+        r.make_endian(target);
+        return r;
+    }
+
+    [[nodiscard]] basic_dynamic_bytes from_endian(endian_t source) const { return to_endian(source); }
+    [[nodiscard]] basic_dynamic_bytes to_little_endian() const { return to_endian(endian_t::little); }
+    [[nodiscard]] basic_dynamic_bytes to_big_endian() const { return to_endian(endian_t::big); }
+    [[nodiscard]] basic_dynamic_bytes to_network() const { return to_big_endian(); }
+    [[nodiscard]] basic_dynamic_bytes from_little_endian() const { return to_little_endian(); }
+    [[nodiscard]] basic_dynamic_bytes from_big_endian() const { return to_big_endian(); }
+    [[nodiscard]] basic_dynamic_bytes from_network() const { return to_big_endian(); }
+
+    // ============= Modifiers =============
+
+    void swap(basic_dynamic_bytes& o) noexcept {
+        using std::swap;
+        if constexpr (block_traits::propagate_on_container_swap::value) swap(alloc_, o.alloc_);
+        swap(blocks_, o.blocks_);
+        swap(size_, o.size_);
+        swap(capacity_, o.capacity_);
+    }
+
+    friend void swap(basic_dynamic_bytes& a, basic_dynamic_bytes& b) noexcept { a.swap(b); }
+};
+
+using dynamic_bytes = basic_dynamic_bytes<>;
+
+namespace pmr {
+/** @brief dynamic_bytes dengan memory_resource (arena, pool, ...) */
+using dynamic_bytes = basic_dynamic_bytes<std::pmr::polymorphic_allocator<uint8_t>>;
+} // namespace pmr
+
+} // namespace zuu
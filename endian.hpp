@@ -9,16 +9,37 @@
  * - Compile-time endian detection
  * - Byte swap operations (optimized intrinsics)
  * - Endian conversion functions
+ * - Bulk byte swap untuk array (pshufb / vpshufb)
+ * - be<T> / le<T>: storage dengan byte order tetap
+ * - load_le / load_be / store_le / store_be: unaligned access + konversi
  * 
  * @note Semua operasi constexpr dan noexcept
  * @note Zero overhead untuk native endian conversions
  */
 
+#include <array>
 #include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
 #include <type_traits>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define ZUU_ENDIAN_SSE2 1
+#endif
+#if defined(__SSSE3__)
+#define ZUU_ENDIAN_SSSE3 1
+#endif
+#if defined(__AVX2__)
+#define ZUU_ENDIAN_AVX2 1
+#endif
+#if defined(__AVX512BW__)
+#define ZUU_ENDIAN_AVX512BW 1
+#endif
+
 namespace zuu {
 
 // ============= Endian Type =============
@@ -45,47 +66,126 @@ inline constexpr endian_t native_endian = is_little_endian ? endian_t::little :
 
 // ============= Byte Swap Primitives =============
 
+#if defined(__has_builtin)
+#define ZUU_HAS_BUILTIN(x) __has_builtin(x)
+#else
+#define ZUU_HAS_BUILTIN(x) 0
+#endif
+
 namespace detail {
 
-/** @brief Swap bytes of 16-bit integer */
+#if defined(__SIZEOF_INT128__)
+/** @brief Alias 128-bit; __extension__ agar -Wpedantic tidak protes (seperti libstdc++) */
+__extension__ typedef __int128 int128_t;
+__extension__ typedef unsigned __int128 uint128_t;
+#endif
+
+/** @brief Unsigned integer dengan ukuran Size byte */
+template <size_t Size>
+using uint_of_size = std::conditional_t<Size == 1, uint8_t,
+                     std::conditional_t<Size == 2, uint16_t,
+                     std::conditional_t<Size == 4, uint32_t,
+#if defined(__SIZEOF_INT128__)
+                     std::conditional_t<Size == 8, uint64_t, uint128_t>>>>;
+#else
+                     uint64_t>>>;
+#endif
+
+/** @brief True untuk __int128 / unsigned __int128 (bukan std::integral di mode strict) */
+template <typename T>
+inline constexpr bool is_int128_v =
+#if defined(__SIZEOF_INT128__)
+    std::is_same_v<std::remove_cv_t<T>, int128_t> ||
+    std::is_same_v<std::remove_cv_t<T>, uint128_t>;
+#else
+    false;
+#endif
+
+/**
+ * @brief Swap bytes of 16-bit integer
+ * @note std::byteswap / __builtin_bswap16 (constexpr, satu rol/movbe);
+ *       fallback mask-shift untuk compiler tanpa builtin
+ */
 [[nodiscard]] constexpr uint16_t bswap16(uint16_t v) noexcept {
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(v);
+#elif ZUU_HAS_BUILTIN(__builtin_bswap16)
+    return __builtin_bswap16(v);
+#else
     return static_cast<uint16_t>((v << 8) | (v >> 8));
+#endif
 }
 
 /** @brief Swap bytes of 32-bit integer */
 [[nodiscard]] constexpr uint32_t bswap32(uint32_t v) noexcept {
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(v);
+#elif ZUU_HAS_BUILTIN(__builtin_bswap32)
+    return __builtin_bswap32(v);
+#else
     return ((v & 0xFF000000u) >> 24) |
            ((v & 0x00FF0000u) >> 8)  |
            ((v & 0x0000FF00u) << 8)  |
            ((v & 0x000000FFu) << 24);
+#endif
 }
 
 /** @brief Swap bytes of 64-bit integer */
 [[nodiscard]] constexpr uint64_t bswap64(uint64_t v) noexcept {
-    return ((v & 0xFF00000000000000ull) >> 56) |
-           ((v & 0x00FF000000000000ull) >> 40) |
-           ((v & 0x0000FF0000000000ull) >> 24) |
-           ((v & 0x000000FF00000000ull) >> 8)  |
-           ((v & 0x00000000FF000000ull) << 8)  |
-           ((v & 0x0000000000FF0000ull) << 24) |
-           ((v & 0x000000000000FF00ull) << 40) |
-           ((v & 0x00000000000000FFull) << 56);
+#if defined(__cpp_lib_byteswap)
+    return std::byteswap(v);
+#elif ZUU_HAS_BUILTIN(__builtin_bswap64)
+    return __builtin_bswap64(v);
+#else
+    v = ((v & 0x00FF00FF00FF00FFull) << 8)  | ((v >> 8)  & 0x00FF00FF00FF00FFull);
+    v = ((v & 0x0000FFFF0000FFFFull) << 16) | ((v >> 16) & 0x0000FFFF0000FFFFull);
+    return (v << 32) | (v >> 32);
+#endif
+}
+
+#if defined(__SIZEOF_INT128__)
+/** @brief Swap bytes of 128-bit integer */
+[[nodiscard]] constexpr uint128_t bswap128(uint128_t v) noexcept {
+#if ZUU_HAS_BUILTIN(__builtin_bswap128)
+    return __builtin_bswap128(v);
+#else
+    return (static_cast<uint128_t>(bswap64(static_cast<uint64_t>(v))) << 64) |
+           bswap64(static_cast<uint64_t>(v >> 64));
+#endif
 }
+#endif
+
+/** @brief Tipe yang didukung byte_swap: integral, __int128, enum, float/double */
+template <typename T>
+concept byte_swap_scalar =
+    std::integral<T> || is_int128_v<T> || std::is_enum_v<T> ||
+    (std::floating_point<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8));
 
 } // namespace detail
 
 // ============= Generic Byte Swap =============
 
 /**
- * @brief Swap bytes dari tipe integral apapun
- * @tparam T Tipe integral
+ * @brief Swap bytes dari integral, __int128, enum, float atau double
+ * @tparam T Tipe scalar (lihat detail::byte_swap_scalar)
  * @param v Value untuk di-swap
  * @return Value dengan byte order terbalik
+ *
+ * Runtime memakai std::byteswap / __builtin_bswap* (satu bswap / movbe);
+ * float dan enum lewat std::bit_cast sehingga tetap constexpr.
+ *
+ * @note Hasil byte_swap pada float bisa berupa NaN signaling; simpan sebagai
+ *       wire value, jangan dipakai untuk aritmetika sebelum di-swap balik.
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T byte_swap(T v) noexcept {
     if constexpr (sizeof(T) == 1) {
         return v;
+    } else if constexpr (std::is_enum_v<T>) {
+        return static_cast<T>(byte_swap(static_cast<std::underlying_type_t<T>>(v)));
+    } else if constexpr (std::floating_point<T>) {
+        using U = detail::uint_of_size<sizeof(T)>;
+        return std::bit_cast<T>(byte_swap(std::bit_cast<U>(v)));
     } else if constexpr (sizeof(T) == 2) {
         return static_cast<T>(detail::bswap16(static_cast<uint16_t>(v)));
     } else if constexpr (sizeof(T) == 4) {
@@ -93,24 +193,49 @@ template <std::integral T>
     } else if constexpr (sizeof(T) == 8) {
         return static_cast<T>(detail::bswap64(static_cast<uint64_t>(v)));
     } else {
-        // Fallback untuk ukuran lain
-        T result{};
-        auto* src = reinterpret_cast<const uint8_t*>(&v);
-        auto* dst = reinterpret_cast<uint8_t*>(&result);
-        for (size_t i = 0; i < sizeof(T); ++i) {
-            dst[i] = src[sizeof(T) - 1 - i];
-        }
-        return result;
+#if defined(__SIZEOF_INT128__)
+        return static_cast<T>(detail::bswap128(static_cast<detail::uint128_t>(v)));
+#endif
     }
 }
 
+namespace detail {
+
+// Self-check compile-time: jalur intrinsic yang terpilih oleh flag build ini
+// tetap constexpr dan benar untuk tiap lebar, signed, enum, float dan 128-bit
+enum class swap_check_e16 : uint16_t { v = 0x1234 };
+enum swap_check_e32 : int32_t { swap_check_v32 = 0x01020304 };
+
+static_assert(byte_swap(uint8_t{0xAB}) == 0xAB);
+static_assert(bswap16(0x1234) == 0x3412);
+static_assert(bswap32(0x01020304u) == 0x04030201u);
+static_assert(bswap64(0x0102030405060708ull) == 0x0807060504030201ull);
+static_assert(byte_swap(uint16_t{0x1234}) == 0x3412);
+static_assert(byte_swap(uint32_t{0x01020304u}) == 0x04030201u);
+static_assert(byte_swap(uint64_t{0x0102030405060708ull}) == 0x0807060504030201ull);
+static_assert(byte_swap(int16_t{-2}) == int16_t{-257});                       // 0xFFFE -> 0xFEFF
+static_assert(byte_swap(int32_t{-2}) == int32_t{-16777217});                  // 0xFFFFFFFE -> 0xFEFFFFFF
+static_assert(byte_swap(int64_t{0x00000000000000FFll}) == int64_t{-0x0100000000000000ll});
+static_assert(byte_swap(swap_check_e16::v) == static_cast<swap_check_e16>(0x3412));
+static_assert(byte_swap(swap_check_v32) == static_cast<swap_check_e32>(0x04030201));
+static_assert(std::bit_cast<uint32_t>(byte_swap(1.0f)) == 0x0000803Fu);
+static_assert(std::bit_cast<uint64_t>(byte_swap(1.0)) == 0x000000000000F03Full);
+static_assert(byte_swap(byte_swap(-1.5f)) == -1.5f && byte_swap(byte_swap(-1.5)) == -1.5);
+#if defined(__SIZEOF_INT128__)
+static_assert(bswap128((uint128_t{0x0102030405060708ull} << 64) | 0x090A0B0C0D0E0F10ull) ==
+              ((uint128_t{0x100F0E0D0C0B0A09ull} << 64) | 0x0807060504030201ull));
+static_assert(byte_swap(int128_t{-2}) == static_cast<int128_t>(~(uint128_t{1} << 120)));
+#endif
+
+} // namespace detail
+
 // ============= Endian Conversion Functions =============
 
 /**
  * @brief Convert native to little-endian
  * @note No-op pada little-endian systems
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T to_little_endian(T v) noexcept {
     if constexpr (is_little_endian) {
         return v;
@@ -123,7 +248,7 @@ template <std::integral T>
  * @brief Convert native to big-endian
  * @note No-op pada big-endian systems
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T to_big_endian(T v) noexcept {
     if constexpr (is_big_endian) {
         return v;
@@ -136,7 +261,7 @@ template <std::integral T>
  * @brief Convert little-endian to native
  * @note No-op pada little-endian systems
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T from_little_endian(T v) noexcept {
     return to_little_endian(v); // Symmetric operation
 }
@@ -145,7 +270,7 @@ template <std::integral T>
  * @brief Convert big-endian to native
  * @note No-op pada big-endian systems
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T from_big_endian(T v) noexcept {
     return to_big_endian(v); // Symmetric operation
 }
@@ -155,7 +280,7 @@ template <std::integral T>
  * @tparam From Source endianness
  * @tparam To Target endianness
  */
-template <endian_t From, endian_t To, std::integral T>
+template <endian_t From, endian_t To, detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T convert_endian(T v) noexcept {
     if constexpr (From == To) {
         return v;
@@ -167,7 +292,7 @@ template <endian_t From, endian_t To, std::integral T>
 /**
  * @brief Convert ke endianness tertentu (runtime)
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T to_endian(T v, endian_t target) noexcept {
     if (target == native_endian) {
         return v;
@@ -179,7 +304,7 @@ template <std::integral T>
 /**
  * @brief Convert dari endianness tertentu ke native (runtime)
  */
-template <std::integral T>
+template <detail::byte_swap_scalar T>
 [[nodiscard]] constexpr T from_endian(T v, endian_t source) noexcept {
     return to_endian(v, source); // Symmetric
 }
@@ -240,6 +365,75 @@ template <std::integral T>
     return from_big_endian(v);
 }
 
+// ============= Unaligned Load / Store =============
+
+namespace detail {
+
+template <endian_t E, typename T>
+[[nodiscard]] inline T load_endian(const void* src) noexcept {
+    using U = uint_of_size<sizeof(T)>;
+    U raw;
+    std::memcpy(&raw, src, sizeof(T));
+    if constexpr (E != native_endian) raw = byte_swap(raw);
+    return std::bit_cast<T>(raw);
+}
+
+template <endian_t E, typename T>
+inline void store_endian(void* dst, T v) noexcept {
+    using U = uint_of_size<sizeof(T)>;
+    U raw = std::bit_cast<U>(v);
+    if constexpr (E != native_endian) raw = byte_swap(raw);
+    std::memcpy(dst, &raw, sizeof(T));
+}
+
+} // namespace detail
+
+/**
+ * @brief Load T little-endian dari alamat unaligned
+ * @note Satu unaligned load (+ bswap pada big-endian host)
+ *
+ * @example
+ * ```cpp
+ * uint32_t len = load_be<uint32_t>(buf + 4);
+ * store_le<double>(out, 1.5);
+ * ```
+ */
+template <detail::byte_swap_scalar T>
+[[nodiscard]] inline T load_le(const void* src) noexcept {
+    return detail::load_endian<endian_t::little, T>(src);
+}
+
+/** @brief Load T big-endian dari alamat unaligned (satu load + bswap / movbe) */
+template <detail::byte_swap_scalar T>
+[[nodiscard]] inline T load_be(const void* src) noexcept {
+    return detail::load_endian<endian_t::big, T>(src);
+}
+
+/** @brief Store T little-endian ke alamat unaligned */
+template <detail::byte_swap_scalar T>
+inline void store_le(void* dst, std::type_identity_t<T> v) noexcept {
+    detail::store_endian<endian_t::little>(dst, v);
+}
+
+/** @brief Store T big-endian ke alamat unaligned */
+template <detail::byte_swap_scalar T>
+inline void store_be(void* dst, std::type_identity_t<T> v) noexcept {
+    detail::store_endian<endian_t::big>(dst, v);
+}
+
+/** @brief Load T dengan byte order runtime */
+template <detail::byte_swap_scalar T>
+[[nodiscard]] inline T load_endian(const void* src, endian_t order) noexcept {
+    return order == endian_t::big ? load_be<T>(src) : load_le<T>(src);
+}
+
+/** @brief Store T dengan byte order runtime */
+template <detail::byte_swap_scalar T>
+inline void store_endian(void* dst, std::type_identity_t<T> v, endian_t order) noexcept {
+    if (order == endian_t::big) store_be<T>(dst, v);
+    else store_le<T>(dst, v);
+}
+
 // ============= Type Traits =============
 
 /** @brief Check if type can be endian-swapped */
@@ -248,4 +442,290 @@ concept endian_swappable = std::integral<T> ||
     (std::is_trivially_copyable_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || 
      sizeof(T) == 4 || sizeof(T) == 8));
 
+
+// ============= Bulk Byte Swap =============
+
+namespace detail {
+
+/**
+ * @brief Mask pshufb: membalik byte setiap elemen Size byte di dalam lane 16-byte
+ * @note vpshufb (AVX2 / AVX-512BW) mengacak per lane 128-bit, jadi mask diulang per lane
+ */
+template <size_t Size>
+inline constexpr auto bswap_shuffle_mask = [] {
+    struct { alignas(64) uint8_t v[64]; } m{};
+    for (size_t i = 0; i < 64; ++i) m.v[i] = static_cast<uint8_t>((i % 16) ^ (Size - 1));
+    return m;
+}();
+
+/**
+ * @brief Balik byte setiap elemen Size byte: dst[i] = bswap(src[i]), count elemen
+ * @note dst boleh sama dengan src (in-place)
+ *
+ * Kernel dipilih saat compile: AVX-512BW (64 B) -> AVX2 (32 B) -> SSSE3 (16 B)
+ * -> SSE2 shift/shuffle (16 B) -> bswap scalar per elemen.
+ */
+template <size_t Size>
+inline void bswap_kernel(uint8_t* dst, const uint8_t* src, size_t count) noexcept {
+    using U = uint_of_size<Size>;
+    const size_t n = count * Size;
+    size_t i = 0;
+#ifdef ZUU_ENDIAN_AVX512BW
+    {
+        const __m512i mask = _mm512_load_si512(bswap_shuffle_mask<Size>.v);
+        for (; i + 64 <= n; i += 64) {
+            const __m512i x = _mm512_loadu_si512(src + i);
+            _mm512_storeu_si512(dst + i, _mm512_shuffle_epi8(x, mask));
+        }
+    }
+#endif
+#ifdef ZUU_ENDIAN_AVX2
+    {
+        const __m256i mask = _mm256_load_si256(reinterpret_cast<const __m256i*>(bswap_shuffle_mask<Size>.v));
+        for (; i + 128 <= n; i += 128) {
+            const auto* s = reinterpret_cast<const __m256i*>(src + i);
+            auto* d = reinterpret_cast<__m256i*>(dst + i);
+            const __m256i a = _mm256_loadu_si256(s), b = _mm256_loadu_si256(s + 1);
+            const __m256i c = _mm256_loadu_si256(s + 2), e = _mm256_loadu_si256(s + 3);
+            _mm256_storeu_si256(d, _mm256_shuffle_epi8(a, mask));
+            _mm256_storeu_si256(d + 1, _mm256_shuffle_epi8(b, mask));
+            _mm256_storeu_si256(d + 2, _mm256_shuffle_epi8(c, mask));
+            _mm256_storeu_si256(d + 3, _mm256_shuffle_epi8(e, mask));
+        }
+        for (; i + 32 <= n; i += 32) {
+            const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_shuffle_epi8(x, mask));
+        }
+    }
+#endif
+#ifdef ZUU_ENDIAN_SSSE3
+    {
+        const __m128i mask = _mm_load_si128(reinterpret_cast<const __m128i*>(bswap_shuffle_mask<Size>.v));
+        for (; i + 16 <= n; i += 16) {
+            const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(x, mask));
+        }
+    }
+#elif defined(ZUU_ENDIAN_SSE2)
+    // Tanpa pshufb: tukar word 16-bit via pshuflw/pshufhw, lalu byte via shift
+    for (; i + 16 <= n; i += 16) {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if constexpr (Size == 16) x = _mm_shuffle_epi32(x, 0x1B);  // balik 4 dword (0xB1 lalu 0x4E)
+        if constexpr (Size == 8) x = _mm_shuffle_epi32(x, 0xB1);
+        if constexpr (Size >= 4) {
+            x = _mm_shufflelo_epi16(x, 0xB1);
+            x = _mm_shufflehi_epi16(x, 0xB1);
+        }
+        x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), x);
+    }
+#endif
+    for (; i < n; i += Size) {
+        U v;
+        std::memcpy(&v, src + i, Size);
+        v = byte_swap(v);
+        std::memcpy(dst + i, &v, Size);
+    }
+}
+
+/** @brief dst[i] = bswap(src[i]) untuk elemen T; constexpr-aware */
+template <endian_swappable T>
+constexpr void bulk_swap(T* dst, const T* src, size_t count) noexcept {
+    using U = uint_of_size<sizeof(T)>;
+    if constexpr (sizeof(T) == 1) {
+        if (dst != src)
+            for (size_t i = 0; i < count; ++i) dst[i] = src[i];
+    } else {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < count; ++i) dst[i] = std::bit_cast<T>(byte_swap(std::bit_cast<U>(src[i])));
+            return;
+        }
+        bswap_kernel<sizeof(T)>(reinterpret_cast<uint8_t*>(dst), reinterpret_cast<const uint8_t*>(src), count);
+    }
+}
+
+/** @brief dst[i] = src[i] tanpa swap; constexpr-aware */
+template <typename T>
+constexpr void bulk_copy(T* dst, const T* src, size_t count) noexcept {
+    if (dst == src) return;
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < count; ++i) dst[i] = src[i];
+        return;
+    }
+    if (count) std::memcpy(dst, src, count * sizeof(T));
+}
+
+} // namespace detail
+
+/**
+ * @brief Balik byte order setiap elemen array in-place
+ * @tparam T Integral / trivially copyable berukuran 1, 2, 4 atau 8 byte
+ *
+ * Memakai pshufb / vpshufb sesuai flag compiler (-mssse3, -mavx2, -mavx512bw),
+ * fallback bswap per elemen.
+ *
+ * @example
+ * ```cpp
+ * std::vector<uint32_t> v = ...;
+ * bulk_byte_swap<uint32_t>(v);
+ * bulk_from_big_endian(std::span{v});     // network -> host
+ * bulk_to_big_endian<uint32_t>(src, dst); // copy-converting
+ * ```
+ */
+template <endian_swappable T>
+constexpr void bulk_byte_swap(std::span<T> data) noexcept {
+    detail::bulk_swap(data.data(), data.data(), data.size());
+}
+
+/**
+ * @brief dst[i] = byte_swap(src[i]) (copy-converting)
+ * @note Memproses min(src.size(), dst.size()) elemen
+ */
+template <endian_swappable T>
+constexpr void bulk_byte_swap(std::span<const T> src, std::span<T> dst) noexcept {
+    detail::bulk_swap(dst.data(), src.data(), src.size() < dst.size() ? src.size() : dst.size());
+}
+
+/** @brief Native -> big-endian in-place (no-op pada big-endian) */
+template <endian_swappable T>
+constexpr void bulk_to_big_endian(std::span<T> data) noexcept {
+    if constexpr (!is_big_endian) bulk_byte_swap(data);
+}
+
+/** @brief Native -> little-endian in-place (no-op pada little-endian) */
+template <endian_swappable T>
+constexpr void bulk_to_little_endian(std::span<T> data) noexcept {
+    if constexpr (!is_little_endian) bulk_byte_swap(data);
+}
+
+/** @brief Big-endian -> native in-place */
+template <endian_swappable T>
+constexpr void bulk_from_big_endian(std::span<T> data) noexcept { bulk_to_big_endian(data); }
+
+/** @brief Little-endian -> native in-place */
+template <endian_swappable T>
+constexpr void bulk_from_little_endian(std::span<T> data) noexcept { bulk_to_little_endian(data); }
+
+/** @brief Native -> big-endian, hasil ke dst (min(src.size(), dst.size()) elemen) */
+template <endian_swappable T>
+constexpr void bulk_to_big_endian(std::span<const T> src, std::span<T> dst) noexcept {
+    const size_t n = src.size() < dst.size() ? src.size() : dst.size();
+    if constexpr (is_big_endian) detail::bulk_copy(dst.data(), src.data(), n);
+    else detail::bulk_swap(dst.data(), src.data(), n);
+}
+
+/** @brief Native -> little-endian, hasil ke dst (min(src.size(), dst.size()) elemen) */
+template <endian_swappable T>
+constexpr void bulk_to_little_endian(std::span<const T> src, std::span<T> dst) noexcept {
+    const size_t n = src.size() < dst.size() ? src.size() : dst.size();
+    if constexpr (is_little_endian) detail::bulk_copy(dst.data(), src.data(), n);
+    else detail::bulk_swap(dst.data(), src.data(), n);
+}
+
+/** @brief Big-endian -> native, hasil ke dst */
+template <endian_swappable T>
+constexpr void bulk_from_big_endian(std::span<const T> src, std::span<T> dst) noexcept {
+    bulk_to_big_endian(src, dst);
+}
+
+/** @brief Little-endian -> native, hasil ke dst */
+template <endian_swappable T>
+constexpr void bulk_from_little_endian(std::span<const T> src, std::span<T> dst) noexcept {
+    bulk_to_little_endian(src, dst);
+}
+
+
+// ============= Endian-Tagged Storage =============
+
+/**
+ * @brief Storage T dengan byte order tetap E (untuk struct on-disk / on-wire)
+ * @tparam E Byte order penyimpanan (endian_t::big / endian_t::little)
+ * @tparam T Integral, __int128, enum, float atau double
+ *
+ * Disimpan sebagai sizeof(T) byte dengan alignment 1, jadi struct header
+ * bisa langsung di-memcpy / bit_cast dari buffer tanpa padding. Konversi
+ * terjadi saat load/store: satu load + bswap (movbe dengan -mmovbe), no-op
+ * bila E == native.
+ *
+ * @note Trivially copyable dan trivial default constructible (byte tidak
+ *       di-inisialisasi); gunakan `be<T>{}` untuk nol.
+ *
+ * @example
+ * ```cpp
+ * struct udp_header {
+ *     be<uint16_t> src_port, dst_port, length, checksum;
+ * };
+ * udp_header h;
+ * std::memcpy(&h, packet, sizeof h);
+ * uint16_t port = h.dst_port;          // ntoh otomatis
+ * h.length = uint16_t(8 + payload);    // hton otomatis
+ * ```
+ */
+template <endian_t E, detail::byte_swap_scalar T>
+requires (E == endian_t::big || E == endian_t::little)
+struct endian_value {
+private:
+    uint8_t bytes_[sizeof(T)];
+
+public:
+    using value_type = T;
+    static constexpr endian_t byte_order = E;
+    static constexpr size_t byte_size = sizeof(T);
+
+    constexpr endian_value() noexcept = default;
+
+    /** @brief Construct dari native value */
+    constexpr explicit endian_value(T v) noexcept { store(v); }
+
+    /** @brief Baca sebagai native value */
+    [[nodiscard]] constexpr T value() const noexcept {
+        using U = detail::uint_of_size<sizeof(T)>;
+        U raw = std::bit_cast<U>(bytes_);
+        if constexpr (E != native_endian) raw = byte_swap(raw);
+        return std::bit_cast<T>(raw);
+    }
+
+    /** @brief Tulis native value */
+    constexpr void store(T v) noexcept {
+        using U = detail::uint_of_size<sizeof(T)>;
+        U raw = std::bit_cast<U>(v);
+        if constexpr (E != native_endian) raw = byte_swap(raw);
+        if (std::is_constant_evaluated()) {
+            const auto b = std::bit_cast<std::array<uint8_t, sizeof(T)>>(raw);
+            for (size_t i = 0; i < sizeof(T); ++i) bytes_[i] = b[i];
+        } else {
+            std::memcpy(bytes_, &raw, sizeof(T));
+        }
+    }
+
+    constexpr endian_value& operator=(T v) noexcept {
+        store(v);
+        return *this;
+    }
+
+    [[nodiscard]] constexpr operator T() const noexcept { return value(); }
+
+    /** @brief Raw bytes dalam byte order E */
+    [[nodiscard]] constexpr uint8_t* data() noexcept { return bytes_; }
+    [[nodiscard]] constexpr const uint8_t* data() const noexcept { return bytes_; }
+    [[nodiscard]] constexpr std::span<const uint8_t, sizeof(T)> as_bytes() const noexcept {
+        return std::span<const uint8_t, sizeof(T)>(bytes_);
+    }
+};
+
+/** @brief T disimpan big-endian (network order) */
+template <typename T>
+using be = endian_value<endian_t::big, T>;
+
+/** @brief T disimpan little-endian */
+template <typename T>
+using le = endian_value<endian_t::little, T>;
+
+using be16 = be<uint16_t>;
+using be32 = be<uint32_t>;
+using be64 = be<uint64_t>;
+using le16 = le<uint16_t>;
+using le32 = le<uint32_t>;
+using le64 = le<uint64_t>;
+
 } // namespace zuu
@@ -5,9 +5,14 @@
 
 #include "generic.hpp"
 #include "bytes.hpp"
+#include "hash.hpp"
+#include <cassert>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 // Custom trivial type untuk testing
 struct Point {
@@ -15,6 +20,14 @@ struct Point {
     constexpr bool operator==(const Point&) const = default;
 };
 
+// Struct dengan padding: hash lewat field_list agar konsisten dengan operator==
+struct Padded {
+    uint8_t tag;
+    uint32_t id;
+    constexpr bool operator==(const Padded&) const = default;
+};
+template <> struct zuu::field_list<Padded> : zuu::fields<&Padded::tag, &Padded::id> {};
+
 int main() {
     using namespace zuu;
     
@@ -202,11 +215,45 @@ int main() {
     std::cout << "16. Integration Example:\n";
     uint32_t ip_addr = 0xC0A80001; // 192.168.0.1
     composer<uint32_t> ip_comp(ip_addr);
-    auto ip_bytes = ip_comp.to_network().as_bytes();
+    auto ip_net = ip_comp.to_network();
+    auto ip_bytes = ip_net.as_bytes();
     
     std::cout << "    IP 0x" << std::hex << ip_addr << " as bytes: ";
     for (auto b : ip_bytes) std::cout << std::dec << (int)b << ".";
-    std::cout << "\b \n";
+    std::cout << "\b \n\n";
+
+    // Hashing: value equal dengan padding berbeda -> satu elemen
+    std::cout << "17. Hashing Padded Struct:\n";
+    Padded pa, pb;
+    std::memset(&pa, 0x00, sizeof(pa));
+    std::memset(&pb, 0xFF, sizeof(pb));
+    pa.tag = pb.tag = 7;
+    pa.id = pb.id = 1234;
+    std::unordered_set<generic<int, double, Padded>> keys;
+    keys.insert(generic<int, double, Padded>(pa));
+    keys.insert(generic<int, double, Padded>(pb));
+    assert(pa == pb && keys.size() == 1);
+    std::cout << "    equal keys, set size = " << keys.size() << "\n";
+
+    // Bulk byte swap: u32 dan u128 (SSE2 / SSSE3 / AVX2 sesuai flag compiler)
+    std::cout << "\n18. Bulk Byte Swap:\n";
+    std::vector<uint32_t> words(37);
+    for (size_t i = 0; i < words.size(); ++i) words[i] = static_cast<uint32_t>(i * 0x01020304u);
+    auto words_ref = words;
+    for (auto& w : words_ref) w = byte_swap(w);
+    bulk_byte_swap(std::span{words});
+    assert(words == words_ref);
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+    std::vector<u128> wide(37);
+    for (size_t i = 0; i < wide.size(); ++i)
+        wide[i] = (static_cast<u128>(i * 0x0123456789ABCDEFull) << 64) | (i + 1);
+    auto wide_ref = wide;
+    for (auto& w : wide_ref) w = byte_swap(w);
+    composer_span(wide).to_network();  // bulk_byte_swap untuk u128 di gnu++20
+    assert(!is_little_endian || wide == wide_ref);
+#endif
+    std::cout << "    u32 / u128 arrays swapped\n";
 
     return 0;
 }
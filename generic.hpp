@@ -16,6 +16,12 @@
 
 #include "typelist.hpp"
 #include "composer.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <concepts>
 #include <cstdint>
 #include <cstring>
 #include <new>
@@ -54,6 +60,335 @@ inline constexpr bool all_nothrow_move_v = (std::is_nothrow_move_constructible_v
 
 } // namespace detail
 
+// ============= Dispatch Policy =============
+
+/**
+ * @brief Strategi dispatch untuk visit
+ *
+ * - fold:  short-circuit `||` fold, linear compare chain (murah untuk 1-2 tipe)
+ * - jump:  switch hasil generate, compiler membuat jump table (maks 16 tipe)
+ * - table: constexpr table of function pointers, O(1) untuk type_count berapapun
+ * - automatic: fold untuk <= 2 tipe, jump untuk <= 16 tipe, selain itu table
+ */
+enum class dispatch_t : uint8_t {
+    automatic,
+    fold,
+    jump,
+    table
+};
+
+/**
+ * @brief Layout penyimpanan tag
+ *
+ * - standard: index_ terpisah setelah data_
+ * - packed:   tag disembunyikan di niche storage (lihat packed_layout_v),
+ *             fallback ke standard jika tidak applicable
+ */
+enum class layout_t : uint8_t {
+    standard,
+    packed
+};
+
+/**
+ * @brief Alternatif "panas" yang dites lebih dulu saat dispatch
+ * @tparam Hs Tipe alternatif, urutan = urutan test
+ * @note Hanya mengubah urutan dispatch, bukan index assignment
+ */
+template <typename... Hs>
+struct hot_order {};
+
+/**
+ * @brief Seperti hot_order tapi dengan index alternatif
+ *        (mis. dari ranking hasil hit_counts())
+ */
+template <size_t... Is>
+struct hot_index {};
+
+/**
+ * @brief Policy default untuk semua generic<Ts...>
+ * @note Inherit dari struct ini saat specialize generic_traits agar
+ *       field yang tidak di-override tetap memakai default
+ */
+struct default_generic_traits {
+    /** @brief Strategi dispatch yang dipakai visit/visit_void */
+    static constexpr dispatch_t dispatch = dispatch_t::automatic;
+
+    /** @brief Layout tag (opt-in packed) */
+    static constexpr layout_t layout = layout_t::standard;
+
+    /** @brief Urutan dispatch alternatif panas (hot_order / hot_index) */
+    using dispatch_order = hot_order<>;
+
+    /** @brief Instrumentation: catat hit count per alternatif saat visit */
+    static constexpr bool profile = false;
+};
+
+/**
+ * @brief Policy per-instansiasi, specialize untuk override
+ * @example
+ * ```cpp
+ * template <>
+ * struct zuu::generic_traits<int, double, Point> : zuu::default_generic_traits {
+ *     static constexpr dispatch_t dispatch = dispatch_t::table;
+ *     using dispatch_order = hot_order<Point>;
+ * };
+ * ```
+ */
+template <typename... Ts>
+struct generic_traits : default_generic_traits {};
+
+namespace detail {
+
+// ============= Niche Layout =============
+
+/**
+ * @brief Analisis niche untuk layout_t::packed
+ *
+ * Tag disimpan di byte tertinggi storage (offset max_size - 1, little-endian).
+ * Syarat:
+ * - tepat satu alternatif memakai seluruh max_size bytes, dan itu pointer
+ *   64-bit; byte tertinggi setiap pointer yang disimpan harus 0 (pointer
+ *   user-space canonical x86-64 / AArch64 tanpa tag), dicek assert di store_index
+ * - alternatif lain <= max_size - 1 bytes, tidak pernah menyentuh byte tag
+ * - type_count <= 127
+ *
+ * Encoding byte tag: < 0x80 = alternatif pointer, 0x80 | i = alternatif i,
+ * 0xFF = valueless.
+ *
+ * @note Pointer kernel space atau dengan top-byte tag (ARM TBI / MTE, HWASan)
+ *       tidak didukung; pakai layout_t::standard untuk pointer seperti itu
+ */
+template <typename... Ts>
+struct niche_layout {
+    static constexpr size_t max_size = type_list_t<Ts...>::max_size;
+    static constexpr size_t tag_offset = max_size - 1;
+    static constexpr size_t full_count = (size_t{0} + ... + (sizeof(Ts) == max_size));
+    static constexpr size_t full_pointer_count =
+        (size_t{0} + ... + (sizeof(Ts) == max_size && std::is_pointer_v<Ts>));
+
+    static constexpr bool applicable = is_little_endian && sizeof(void*) == 8 &&
+        max_size == 8 && full_count == 1 && full_pointer_count == 1 && sizeof...(Ts) <= 127;
+
+    /** @brief Index alternatif pointer (yang memegang niche) */
+    static constexpr size_t pointer_index = [] {
+        size_t i = 0, found = 0;
+        ((std::is_pointer_v<Ts> && sizeof(Ts) == max_size ? (found = i, ++i) : ++i), ...);
+        return found;
+    }();
+
+    static constexpr uint8_t tag_valueless = 0xFF;
+    static constexpr uint8_t tag_flag = 0x80;
+};
+
+/** @brief index_ terpisah (layout standard) */
+template <typename IndexT, bool Separate>
+struct tag_slot {
+    IndexT value = npos<IndexT>;
+};
+
+/** @brief Tidak ada index_ terpisah (layout packed) */
+template <typename IndexT>
+struct tag_slot<IndexT, false> {};
+
+// ============= Value Comparison =============
+
+/**
+ * @brief Bandingkan dua T untuk equality
+ *
+ * - Unique object representation (tanpa padding, integer, pointer):
+ *   memcmp sizeof(T) bytes
+ * - Selain itu: T::operator== (float: -0.0 == 0.0, struct dengan padding)
+ * - Tanpa operator==: fallback memcmp sizeof(T) bytes
+ */
+template <typename T>
+inline constexpr bool bytewise_equal_v =
+    std::has_unique_object_representations_v<T> || !std::equality_comparable<T>;
+
+template <typename T>
+[[nodiscard]] constexpr bool equal_value(const T& a, const T& b) noexcept {
+    if constexpr (bytewise_equal_v<T>) {
+        if constexpr (std::equality_comparable<T>) {
+            if (std::is_constant_evaluated()) return a == b;
+        }
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    } else {
+        return a == b;
+    }
+}
+
+// ============= Dispatch Engine =============
+
+/** @brief Batas type_count untuk dispatch_t::jump */
+inline constexpr size_t jump_dispatch_limit = 16;
+
+template <size_t I>
+using index_constant = std::integral_constant<size_t, I>;
+
+/** @brief Entry table: panggil g dengan index compile-time I */
+template <size_t I, typename R, typename G>
+constexpr R dispatch_thunk(G& g) {
+    return g(index_constant<I>{});
+}
+
+template <typename R, typename G, typename Seq>
+struct dispatch_table;
+
+template <typename R, typename G, size_t... Is>
+struct dispatch_table<R, G, std::index_sequence<Is...>> {
+    static constexpr R (*entries[])(G&) = { &dispatch_thunk<Is, R, G>... };
+};
+
+/**
+ * @brief Hasil untuk index di luar [0, N): R{} jika R default constructible,
+ *        selain itu (mis. std::partial_ordering) caller menjamin index < N
+ *        dan alternatif terakhir dipakai sebagai default branch
+ */
+template <typename R, size_t N, typename G>
+constexpr R dispatch_default(G& g) {
+    if constexpr (std::is_void_v<R>) return;
+    else if constexpr (std::is_default_constructible_v<R>) return R{};
+    else return g(index_constant<N - 1>{});
+}
+
+/** @brief Compare chain rekursif untuk R yang tidak default constructible */
+template <typename R, size_t N, size_t I, typename G>
+constexpr R dispatch_chain(size_t index, G& g) {
+    if constexpr (I + 1 == N) {
+        return g(index_constant<I>{});
+    } else {
+        if (index == I) return g(index_constant<I>{});
+        return dispatch_chain<R, N, I + 1>(index, g);
+    }
+}
+
+template <typename R, size_t N, typename G>
+constexpr R dispatch_fold(size_t index, G& g) {
+    if constexpr (!std::is_void_v<R> && !std::is_default_constructible_v<R>) {
+        return dispatch_chain<R, N, 0>(index, g);
+    } else {
+        return [&]<size_t... Is>(std::index_sequence<Is...>) -> R {
+            if constexpr (std::is_void_v<R>) {
+                ((index == Is ? (g(index_constant<Is>{}), true) : false) || ...);
+            } else {
+                R result{};
+                ((index == Is ? (result = g(index_constant<Is>{}), true) : false) || ...);
+                return result;
+            }
+        }(std::make_index_sequence<N>{});
+    }
+}
+
+template <typename R, size_t N, typename G>
+constexpr R dispatch_jump(size_t index, G& g) {
+    static_assert(N <= jump_dispatch_limit, "dispatch_jump supports at most 16 alternatives");
+
+#define ZUU_DISPATCH_CASE(I) \
+    case I: \
+        if constexpr (I < N) return g(index_constant<I>{}); \
+        else break;
+
+    switch (index) {
+        ZUU_DISPATCH_CASE(0)  ZUU_DISPATCH_CASE(1)  ZUU_DISPATCH_CASE(2)  ZUU_DISPATCH_CASE(3)
+        ZUU_DISPATCH_CASE(4)  ZUU_DISPATCH_CASE(5)  ZUU_DISPATCH_CASE(6)  ZUU_DISPATCH_CASE(7)
+        ZUU_DISPATCH_CASE(8)  ZUU_DISPATCH_CASE(9)  ZUU_DISPATCH_CASE(10) ZUU_DISPATCH_CASE(11)
+        ZUU_DISPATCH_CASE(12) ZUU_DISPATCH_CASE(13) ZUU_DISPATCH_CASE(14) ZUU_DISPATCH_CASE(15)
+        default: break;
+    }
+
+#undef ZUU_DISPATCH_CASE
+
+    return dispatch_default<R, N>(g);
+}
+
+template <typename R, size_t N, typename G>
+constexpr R dispatch_via_table(size_t index, G& g) {
+    if (index >= N) return dispatch_default<R, N>(g);
+    return dispatch_table<R, G, std::make_index_sequence<N>>::entries[index](g);
+}
+
+/**
+ * @brief Panggil g(index_constant<I>{}) untuk I == index
+ * @tparam R Return type (void diperbolehkan)
+ * @tparam N Jumlah index valid; index >= N menghasilkan R{}
+ * @tparam D Strategi dispatch
+ */
+template <typename R, size_t N, dispatch_t D, typename G>
+constexpr R dispatch(size_t index, G& g) {
+    if constexpr (D == dispatch_t::automatic) {
+        if constexpr (N <= 2) return dispatch_fold<R, N>(index, g);
+        else if constexpr (N <= jump_dispatch_limit) return dispatch_jump<R, N>(index, g);
+        else return dispatch_via_table<R, N>(index, g);
+    } else if constexpr (D == dispatch_t::fold) {
+        return dispatch_fold<R, N>(index, g);
+    } else if constexpr (D == dispatch_t::jump && N <= jump_dispatch_limit) {
+        return dispatch_jump<R, N>(index, g);
+    } else {
+        return dispatch_via_table<R, N>(index, g);
+    }
+}
+
+// ============= Hot Ordering & Profiling =============
+
+template <typename List, typename Order>
+struct hot_sequence;
+
+template <typename... Ts, typename... Hs>
+struct hot_sequence<type_list_t<Ts...>, hot_order<Hs...>> {
+    static_assert((type_list_t<Ts...>::template contains<Hs> && ...),
+        "hot_order contains a type that is not an alternative");
+    using type = std::index_sequence<type_list_t<Ts...>::template index_of<Hs>...>;
+};
+
+template <typename... Ts, size_t... Is>
+struct hot_sequence<type_list_t<Ts...>, hot_index<Is...>> {
+    static_assert(((Is < sizeof...(Ts)) && ...), "hot_index out of range");
+    using type = std::index_sequence<Is...>;
+};
+
+/** @brief Test alternatif panas berurutan, sisanya lewat dispatch D */
+template <typename R, size_t N, dispatch_t D, typename G>
+constexpr R dispatch_hot(size_t index, G& g, std::index_sequence<>) {
+    return dispatch<R, N, D>(index, g);
+}
+
+template <typename R, size_t N, dispatch_t D, typename G, size_t H, size_t... Hs>
+constexpr R dispatch_hot(size_t index, G& g, std::index_sequence<H, Hs...>) {
+    if (index == H) [[likely]] return g(index_constant<H>{});
+    return dispatch_hot<R, N, D>(index, g, std::index_sequence<Hs...>{});
+}
+
+/** @brief Hit counter per alternatif, satu set per type list */
+template <typename List>
+inline std::atomic<uint64_t> visit_hits[List::count]{};
+
+/**
+ * @brief Dispatch sesuai generic_traits: profile, hot order, lalu strategi
+ * @tparam List type_list_t alternatif (kunci counter profile)
+ */
+template <typename R, typename Traits, typename List, typename G>
+constexpr R traits_dispatch(size_t index, G& g) {
+    if constexpr (Traits::profile) {
+        if (!std::is_constant_evaluated() && index < List::count) {
+            visit_hits<List>[index].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    using hot = typename hot_sequence<List, typename Traits::dispatch_order>::type;
+    return dispatch_hot<R, List::count, Traits::dispatch>(index, g, hot{});
+}
+
+} // namespace detail
+
+/**
+ * @brief True jika generic<Ts...> bisa memakai layout_t::packed
+ * @example
+ * ```cpp
+ * static_assert(packed_layout_v<Node*, int, float>);   // 8 bytes
+ * static_assert(!packed_layout_v<int64_t, double>);    // tidak ada niche
+ * ```
+ */
+template <typename... Ts>
+inline constexpr bool packed_layout_v = detail::niche_layout<Ts...>::applicable;
+
 // ============= Overload Helper =============
 
 /**
@@ -79,8 +414,8 @@ template <typename... Fs> overload(Fs...) -> overload<Fs...>;
  * @tparam Ts Tipe-tipe yang dapat disimpan (min 1, semua harus trivially copyable)
  * 
  * Memory layout:
- * - index_: 1-4 bytes (tergantung jumlah tipe)
  * - data_: max(sizeof(Ts)...) bytes, aligned ke max(alignof(Ts)...)
+ * - index_: 1-4 bytes (tergantung jumlah tipe), tidak ada jika is_packed
  * 
  * @note Tidak ada dynamic allocation
  * @note Semua operasi noexcept jika tipe mendukung
@@ -94,6 +429,7 @@ class generic {
 public:
     // ============= Type Aliases =============
     using list_t = type_list_t<Ts...>;
+    using traits_t = generic_traits<Ts...>;
     using index_type = detail::index_type<sizeof...(Ts)>;
     
     static constexpr size_t type_count = sizeof...(Ts);
@@ -101,16 +437,95 @@ public:
     static constexpr size_t max_align = list_t::max_align;
     static constexpr index_type npos = detail::npos<index_type>;
 
+    /** @brief True jika tag disimpan di niche data_ (layout_t::packed applicable) */
+    static constexpr bool is_packed =
+        traits_t::layout == layout_t::packed && packed_layout_v<Ts...>;
+
 private:
+    using niche_t = detail::niche_layout<Ts...>;
+
     // Storage dengan alignment yang benar
     alignas(max_align) uint8_t data_[max_size]{};
-    index_type index_ = npos;
+    [[no_unique_address]] detail::tag_slot<index_type, !is_packed> index_;
+
+    // ============= Tag Access =============
+
+    [[nodiscard]] constexpr index_type load_index() const noexcept {
+        if constexpr (is_packed) {
+            const uint8_t tag = data_[niche_t::tag_offset];
+            if (tag < niche_t::tag_flag) return static_cast<index_type>(niche_t::pointer_index);
+            if (tag == niche_t::tag_valueless) return npos;
+            return static_cast<index_type>(tag & ~niche_t::tag_flag);
+        } else {
+            return index_.value;
+        }
+    }
+
+    /**
+     * @note Dipanggil setelah store(): alternatif pointer sudah menulis byte tag
+     * @pre Alternatif pointer: byte tertinggi pointer == 0 (dicek di debug build)
+     */
+    constexpr void store_index(index_type i) noexcept {
+        if constexpr (is_packed) {
+            if (i == npos) data_[niche_t::tag_offset] = niche_t::tag_valueless;
+            else if (i != niche_t::pointer_index) {
+                data_[niche_t::tag_offset] = static_cast<uint8_t>(niche_t::tag_flag | i);
+            } else if (!std::is_constant_evaluated()) {
+                assert(data_[niche_t::tag_offset] == 0 &&
+                       "layout_t::packed: byte tertinggi pointer harus 0");
+            }
+        } else {
+            index_.value = i;
+        }
+    }
 
     // ============= Internal Helpers =============
 
     template <typename T>
     static constexpr index_type index_of_v = static_cast<index_type>(list_t::template index_of<T>);
 
+    /** @brief sizeof tiap alternatif */
+    static constexpr size_t alternative_sizes[] = { sizeof(Ts)... };
+
+    /** @brief Alternatif yang equality-nya cukup memcmp sizeof(T) bytes */
+    static constexpr bool bytewise_equal[] = { detail::bytewise_equal_v<Ts>... };
+
+    /** @brief Jumlah word 64-bit yang menutup data_ untuk masked compare */
+    static constexpr size_t compare_words = (max_size + 7) / 8;
+
+    /** @brief Mask per alternatif: hanya byte [0, sizeof(T)) yang dibandingkan */
+    static constexpr auto compare_masks = [] {
+        std::array<std::array<uint64_t, compare_words>, type_count> m{};
+        for (size_t t = 0; t < type_count; ++t) {
+            for (size_t b = 0; b < alternative_sizes[t]; ++b) {
+                const size_t shift = is_little_endian ? (b % 8) * 8 : (7 - b % 8) * 8;
+                m[t][b / 8] |= uint64_t{0xFF} << shift;
+            }
+        }
+        return m;
+    }();
+
+    /** @brief memcmp sizeof(T) bytes; masked word compare untuk storage kecil */
+    [[nodiscard]] bool bytewise_eq(const generic& o, index_type i) const noexcept {
+        if constexpr (compare_words <= 4) {
+            uint64_t diff = 0;
+            [&]<size_t... Ws>(std::index_sequence<Ws...>) {
+                ((diff |= (load_word<Ws>(data_) ^ load_word<Ws>(o.data_)) & compare_masks[i][Ws]), ...);
+            }(std::make_index_sequence<compare_words>{});
+            return diff == 0;
+        } else {
+            return std::memcmp(data_, o.data_, alternative_sizes[i]) == 0;
+        }
+    }
+
+    template <size_t W>
+    [[nodiscard]] static uint64_t load_word(const uint8_t* p) noexcept {
+        constexpr size_t n = max_size - W * 8 < 8 ? max_size - W * 8 : 8;
+        uint64_t w = 0;
+        std::memcpy(&w, p + W * 8, n);
+        return w;
+    }
+
     /** @brief Copy data dari value ke storage */
     template <typename T>
     constexpr void store(const T& value) noexcept {
@@ -130,39 +545,24 @@ private:
 
     // ============= Visit Implementation =============
 
-    template <typename R, typename F, size_t... Is>
-    [[nodiscard]] constexpr R visit_impl(F&& f, std::index_sequence<Is...>) {
-        R result{};
-        ((index_ == Is ? (result = std::forward<F>(f)(*ptr<typename list_t::template type<Is>>()), true) 
-                       : false) || ...);
-        return result;
-    }
-
-    template <typename R, typename F, size_t... Is>
-    [[nodiscard]] constexpr R visit_impl(F&& f, std::index_sequence<Is...>) const {
-        R result{};
-        ((index_ == Is ? (result = std::forward<F>(f)(*ptr<typename list_t::template type<Is>>()), true) 
-                       : false) || ...);
-        return result;
-    }
-
-    template <typename F, size_t... Is>
-    constexpr void visit_void_impl(F&& f, std::index_sequence<Is...>) {
-        ((index_ == Is ? (std::forward<F>(f)(*ptr<typename list_t::template type<Is>>()), true) 
-                       : false) || ...);
-    }
-
-    template <typename F, size_t... Is>
-    constexpr void visit_void_impl(F&& f, std::index_sequence<Is...>) const {
-        ((index_ == Is ? (std::forward<F>(f)(*ptr<typename list_t::template type<Is>>()), true) 
-                       : false) || ...);
+    template <typename R, typename F, typename Self>
+    [[nodiscard]] static constexpr R visit_impl(Self& self, F&& f) {
+        auto invoke = [&](auto I) -> R {
+            if constexpr (std::is_void_v<R>) {
+                // visit_void: return value visitor diabaikan
+                (void)std::forward<F>(f)(*self.template ptr<typename list_t::template type<I>>());
+            } else {
+                return std::forward<F>(f)(*self.template ptr<typename list_t::template type<I>>());
+            }
+        };
+        return detail::traits_dispatch<R, traits_t, list_t>(self.load_index(), invoke);
     }
 
 public:
     // ============= Constructors =============
 
     /** @brief Default: valueless state */
-    constexpr generic() noexcept = default;
+    constexpr generic() noexcept { store_index(npos); }
     constexpr generic(const generic&) noexcept = default;
     constexpr generic(generic&&) noexcept = default;
     constexpr generic& operator=(const generic&) noexcept = default;
@@ -171,17 +571,17 @@ public:
     /** @brief Construct dari value */
     template <typename T>
     requires (list_t::template contains<T>)
-    constexpr generic(const T& value) noexcept 
-        : index_(index_of_v<T>) {
+    constexpr generic(const T& value) noexcept {
         store(value);
+        store_index(index_of_v<T>);
     }
 
     /** @brief Construct dari value (move) */
     template <typename T>
     requires (list_t::template contains<T>)
-    constexpr generic(T&& value) noexcept 
-        : index_(index_of_v<std::decay_t<T>>) {
+    constexpr generic(T&& value) noexcept {
         store(std::forward<T>(value));
+        store_index(index_of_v<std::decay_t<T>>);
     }
 
     // ============= Modifiers =============
@@ -192,7 +592,7 @@ public:
     constexpr T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
         T temp(std::forward<Args>(args)...);
         store(temp);
-        index_ = index_of_v<T>;
+        store_index(index_of_v<T>);
         return *ptr<T>();
     }
 
@@ -201,13 +601,13 @@ public:
     requires (list_t::template contains<T>)
     constexpr generic& operator=(const T& value) noexcept {
         store(value);
-        index_ = index_of_v<T>;
+        store_index(index_of_v<T>);
         return *this;
     }
 
     /** @brief Reset ke valueless state */
     constexpr void reset() noexcept {
-        index_ = npos;
+        store_index(npos);
     }
 
     /** @brief Swap dengan generic lain */
@@ -220,17 +620,17 @@ public:
     // ============= Observers =============
 
     /** @brief Cek apakah memiliki value */
-    [[nodiscard]] constexpr bool has_value() const noexcept { return index_ != npos; }
+    [[nodiscard]] constexpr bool has_value() const noexcept { return load_index() != npos; }
     [[nodiscard]] constexpr explicit operator bool() const noexcept { return has_value(); }
 
     /** @brief Get current type index */
-    [[nodiscard]] constexpr index_type index() const noexcept { return index_; }
+    [[nodiscard]] constexpr index_type index() const noexcept { return load_index(); }
 
     /** @brief Cek apakah menyimpan tipe T */
     template <typename T>
     requires (list_t::template contains<T>)
     [[nodiscard]] constexpr bool holds() const noexcept {
-        return index_ == index_of_v<T>;
+        return load_index() == index_of_v<T>;
     }
 
     // ============= Access =============
@@ -239,14 +639,14 @@ public:
     template <typename T>
     requires (list_t::template contains<T>)
     [[nodiscard]] constexpr T& get() {
-        if (index_ != index_of_v<T>) throw std::bad_cast();
+        if (load_index() != index_of_v<T>) throw std::bad_cast();
         return *ptr<T>();
     }
 
     template <typename T>
     requires (list_t::template contains<T>)
     [[nodiscard]] constexpr const T& get() const {
-        if (index_ != index_of_v<T>) throw std::bad_cast();
+        if (load_index() != index_of_v<T>) throw std::bad_cast();
         return *ptr<T>();
     }
 
@@ -263,13 +663,13 @@ public:
     template <typename T>
     requires (list_t::template contains<T>)
     [[nodiscard]] constexpr T* get_if() noexcept {
-        return index_ == index_of_v<T> ? ptr<T>() : nullptr;
+        return load_index() == index_of_v<T> ? ptr<T>() : nullptr;
     }
 
     template <typename T>
     requires (list_t::template contains<T>)
     [[nodiscard]] constexpr const T* get_if() const noexcept {
-        return index_ == index_of_v<T> ? ptr<T>() : nullptr;
+        return load_index() == index_of_v<T> ? ptr<T>() : nullptr;
     }
 
     // ============= Visitation =============
@@ -278,32 +678,101 @@ public:
     template <typename F>
     [[nodiscard]] constexpr auto visit(F&& f) {
         using R = std::common_type_t<decltype(f(std::declval<Ts&>()))...>;
-        return visit_impl<R>(std::forward<F>(f), std::make_index_sequence<type_count>{});
+        return visit_impl<R>(*this, std::forward<F>(f));
     }
 
     template <typename F>
     [[nodiscard]] constexpr auto visit(F&& f) const {
         using R = std::common_type_t<decltype(f(std::declval<const Ts&>()))...>;
-        return visit_impl<R>(std::forward<F>(f), std::make_index_sequence<type_count>{});
+        return visit_impl<R>(*this, std::forward<F>(f));
     }
 
     /** @brief Visit tanpa return value (untuk side effects) */
     template <typename F>
     constexpr void visit_void(F&& f) {
-        visit_void_impl(std::forward<F>(f), std::make_index_sequence<type_count>{});
+        visit_impl<void>(*this, std::forward<F>(f));
     }
 
     template <typename F>
     constexpr void visit_void(F&& f) const {
-        visit_void_impl(std::forward<F>(f), std::make_index_sequence<type_count>{});
+        visit_impl<void>(*this, std::forward<F>(f));
+    }
+
+    // ============= Profiling =============
+
+    /**
+     * @brief Snapshot hit count visit per alternatif (semua instance)
+     * @note Hanya tersedia jika generic_traits<Ts...>::profile == true
+     */
+    [[nodiscard]] static std::array<uint64_t, type_count> hit_counts() noexcept
+    requires (traits_t::profile) {
+        std::array<uint64_t, type_count> r{};
+        for (size_t i = 0; i < type_count; ++i) {
+            r[i] = detail::visit_hits<list_t>[i].load(std::memory_order_relaxed);
+        }
+        return r;
+    }
+
+    /** @brief Reset semua hit count ke 0 */
+    static void reset_hit_counts() noexcept
+    requires (traits_t::profile) {
+        for (auto& h : detail::visit_hits<list_t>) h.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Index alternatif diurutkan dari hit count terbanyak
+     * @note Salin hasilnya ke hot_index<...> untuk dispatch_order
+     */
+    [[nodiscard]] static std::array<size_t, type_count> hot_ranking() noexcept
+    requires (traits_t::profile) {
+        const auto counts = hit_counts();
+        std::array<size_t, type_count> r{};
+        for (size_t i = 0; i < type_count; ++i) r[i] = i;
+        std::stable_sort(r.begin(), r.end(),
+            [&](size_t a, size_t b) { return counts[a] > counts[b]; });
+        return r;
     }
 
     // ============= Comparison =============
 
+    /**
+     * @brief Equal jika index sama dan alternatif aktif equal
+     * @note Hanya sizeof(T) bytes alternatif aktif yang dibandingkan,
+     *       lihat detail::equal_value
+     */
     [[nodiscard]] constexpr bool operator==(const generic& o) const noexcept {
-        if (index_ != o.index_) return false;
-        if (index_ == npos) return true;
-        return std::memcmp(data_, o.data_, max_size) == 0;
+        const index_type i = load_index();
+        if (i != o.load_index()) return false;
+        if (i == npos) return true;
+        if (!std::is_constant_evaluated() && bytewise_equal[i]) {
+            return bytewise_eq(o, i);
+        }
+        auto invoke = [&](auto I) -> bool {
+            using T = typename list_t::template type<I>;
+            return detail::equal_value(*ptr<T>(), *o.template ptr<T>());
+        };
+        return detail::dispatch<bool, type_count, traits_t::dispatch>(i, invoke);
+    }
+
+    /**
+     * @brief Ordering: valueless < value, lalu index, lalu T::operator<=>
+     */
+    [[nodiscard]] constexpr auto operator<=>(const generic& o) const noexcept
+    requires (std::three_way_comparable<Ts> && ...) {
+        using R = std::common_comparison_category_t<std::compare_three_way_result_t<Ts>...>;
+        const index_type i = load_index();
+        const index_type j = o.load_index();
+        if (i != j) {
+            if (i == npos) return R(std::strong_ordering::less);
+            if (j == npos) return R(std::strong_ordering::greater);
+            return R(i <=> j);
+        }
+        if (i == npos) return R(std::strong_ordering::equal);
+        auto invoke = [&](auto I) -> R {
+            using T = typename list_t::template type<I>;
+            return *ptr<T>() <=> *o.template ptr<T>();
+        };
+        return detail::dispatch<R, type_count, traits_t::dispatch>(i, invoke);
     }
 
     // ============= Raw Access =============
@@ -332,4 +801,88 @@ constexpr void swap(generic<Ts...>& a, generic<Ts...>& b) noexcept {
     a.swap(b);
 }
 
+// ============= Type Traits =============
+
+/** @brief Check if type is a generic */
+template <typename T>
+struct is_generic : std::false_type {};
+
+template <typename... Ts>
+struct is_generic<generic<Ts...>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_generic_v = is_generic<std::remove_cvref_t<T>>::value;
+
+// ============= Multi Visit =============
+
+namespace detail {
+
+/** @brief Layout combined index untuk visit atas beberapa generic */
+template <typename... Gs>
+struct multi_visit_info {
+    static constexpr size_t counts[] = { std::remove_cvref_t<Gs>::type_count... };
+    static constexpr size_t total = (size_t{1} * ... * std::remove_cvref_t<Gs>::type_count);
+
+    /** @brief Index alternatif generic ke-K dari combined index I */
+    static constexpr size_t index_at(size_t I, size_t K) noexcept {
+        size_t stride = 1;
+        for (size_t k = K + 1; k < sizeof...(Gs); ++k) stride *= counts[k];
+        return (I / stride) % counts[K];
+    }
+};
+
+template <typename G, size_t J>
+using alternative_t = typename std::remove_cvref_t<G>::list_t::template type<J>;
+
+template <size_t I, typename F, typename... Gs, size_t... Ks>
+constexpr decltype(auto) multi_invoke(F& f, std::index_sequence<Ks...>, Gs&... gs) {
+    using info = multi_visit_info<Gs...>;
+    return f(gs.template get_unchecked<alternative_t<Gs, info::index_at(I, Ks)>>()...);
+}
+
+template <typename F, typename... Gs, size_t... Is>
+auto multi_visit_result(std::index_sequence<Is...>)
+    -> std::common_type_t<decltype(multi_invoke<Is>(std::declval<F&>(),
+                                                    std::index_sequence_for<Gs...>{},
+                                                    std::declval<Gs&>()...))...>;
+
+} // namespace detail
+
+/**
+ * @brief Visit beberapa generic sekaligus dengan satu dispatch
+ * @param f Callable yang menerima satu alternatif dari tiap generic
+ * @param gs Generic yang di-visit
+ * @return common_type dari semua kombinasi; R{} jika ada yang valueless
+ *
+ * Combined index (row-major) di-dispatch lewat satu table berisi
+ * type_count1 * type_count2 * ... entry, bukan nested linear chain.
+ *
+ * @example
+ * ```cpp
+ * generic<int, double> a(2), b(0.5);
+ * auto r = zuu::visit([](auto x, auto y) { return x * y; }, a, b); // double
+ * ```
+ */
+template <typename F, typename... Gs>
+requires (sizeof...(Gs) > 0 && (is_generic_v<Gs> && ...))
+[[nodiscard]] constexpr auto visit(F&& f, Gs&&... gs) {
+    using info = detail::multi_visit_info<Gs...>;
+    using R = decltype(detail::multi_visit_result<F, std::remove_reference_t<Gs>...>(
+        std::make_index_sequence<info::total>{}));
+
+    size_t index = 0;
+    bool valueless = false;
+    ((valueless |= !gs.has_value(),
+      index = index * std::remove_cvref_t<Gs>::type_count + gs.index()), ...);
+    if (valueless) {
+        if constexpr (std::is_void_v<R>) return;
+        else return R{};
+    }
+
+    auto invoke = [&](auto I) -> R {
+        return detail::multi_invoke<I>(f, std::index_sequence_for<Gs...>{}, gs...);
+    };
+    return detail::dispatch<R, info::total, dispatch_t::automatic>(index, invoke);
+}
+
 } // namespace zuu
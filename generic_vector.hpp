@@ -0,0 +1,560 @@
+#pragma once
+
+/**
+ * @file generic_vector.hpp
+ * @brief Structure-of-arrays container untuk koleksi generic
+ * @version 1.0.0
+ *
+ * std::vector<generic<Ts...>> membayar padding per elemen karena index_
+ * diletakkan setelah data_ yang aligned (generic<int, double> = 16 bytes).
+ * generic_vector menyimpan:
+ * - tags:     satu array padat index_type (scan tag cache-friendly)
+ * - payloads: array slot aligned, stride = max_size dibulatkan ke max_align
+ *
+ * @note Semua tipe harus trivially copyable (sama seperti generic)
+ */
+
+#include "generic.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @brief Container SoA untuk generic<Ts...>
+ * @tparam Ts Tipe alternatif (sama dengan generic<Ts...>)
+ *
+ * @example
+ * ```cpp
+ * generic_vector<int, double, Point> v;
+ * v.push_back(42);
+ * v.emplace_back<Point>(1.0f, 2.0f);
+ * for (auto e : v) e.visit_void([](auto& x) { ... });
+ * generic<int, double, Point> g = v.get(0);
+ * ```
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+class generic_vector {
+public:
+    // ============= Type Aliases =============
+    using value_type = generic<Ts...>;
+    using list_t = typename value_type::list_t;
+    using traits_t = typename value_type::traits_t;
+    using index_type = typename value_type::index_type;
+    using size_type = size_t;
+
+    static constexpr size_t type_count = value_type::type_count;
+    static constexpr size_t max_size = value_type::max_size;
+    static constexpr size_t max_align = value_type::max_align;
+    static constexpr index_type npos = value_type::npos;
+
+    /** @brief Jarak antar payload (max_size dibulatkan ke max_align) */
+    static constexpr size_t stride = (max_size + max_align - 1) / max_align * max_align;
+
+    /** @brief Bytes per elemen (tag + payload), bandingkan dengan sizeof(generic) */
+    static constexpr size_t bytes_per_element = sizeof(index_type) + stride;
+
+private:
+    struct alignas(max_align) slot {
+        uint8_t bytes[stride];
+    };
+
+    std::vector<index_type> tags_;
+    std::vector<slot> slots_;
+
+    template <typename T>
+    static constexpr index_type index_of_v = static_cast<index_type>(list_t::template index_of<T>);
+
+    template <typename T>
+    [[nodiscard]] T* ptr(size_type i) noexcept {
+        return std::launder(reinterpret_cast<T*>(slots_[i].bytes));
+    }
+
+    template <typename T>
+    [[nodiscard]] const T* ptr(size_type i) const noexcept {
+        return std::launder(reinterpret_cast<const T*>(slots_[i].bytes));
+    }
+
+    template <typename R, typename F, typename Self>
+    [[nodiscard]] static R visit_impl(Self& self, size_type i, F&& f) {
+        auto invoke = [&](auto I) -> R {
+            if constexpr (std::is_void_v<R>) {
+                // visit_void: return value visitor diabaikan
+                (void)std::forward<F>(f)(*self.template ptr<typename list_t::template type<I>>(i));
+            } else {
+                return std::forward<F>(f)(*self.template ptr<typename list_t::template type<I>>(i));
+            }
+        };
+        return detail::traits_dispatch<R, traits_t, list_t>(self.tags_[i], invoke);
+    }
+
+    template <bool Const>
+    class basic_reference;
+
+    template <bool Const>
+    class basic_iterator;
+
+public:
+    /** @brief Proxy ke elemen ke-i (mutable) */
+    using reference = basic_reference<false>;
+    /** @brief Proxy ke elemen ke-i (read-only) */
+    using const_reference = basic_reference<true>;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // ============= Constructors =============
+
+    generic_vector() = default;
+
+    /** @brief Construct dari daftar generic */
+    generic_vector(std::initializer_list<value_type> init) {
+        reserve(init.size());
+        for (const auto& g : init) push_back(g);
+    }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return tags_.size(); }
+    [[nodiscard]] bool empty() const noexcept { return tags_.empty(); }
+    [[nodiscard]] size_type capacity() const noexcept { return tags_.capacity(); }
+
+    void reserve(size_type n) {
+        tags_.reserve(n);
+        slots_.reserve(n);
+    }
+
+    void shrink_to_fit() {
+        tags_.shrink_to_fit();
+        slots_.shrink_to_fit();
+    }
+
+    // ============= Modifiers =============
+
+    /** @brief Append generic (tag + payload di-copy) */
+    void push_back(const value_type& g) {
+        slot& s = slots_.emplace_back();
+        std::memcpy(s.bytes, g.data(), max_size);
+        tags_.push_back(g.index());
+    }
+
+    /** @brief Append value dari tipe T */
+    template <typename T>
+    requires (list_t::template contains<T>)
+    void push_back(const T& value) {
+        slot& s = slots_.emplace_back();
+        std::memcpy(s.bytes, &value, sizeof(T));
+        tags_.push_back(index_of_v<T>);
+    }
+
+    /** @brief In-place construct tipe T di akhir */
+    template <typename T, typename... Args>
+    requires (list_t::template contains<T> && std::is_constructible_v<T, Args...>)
+    T& emplace_back(Args&&... args) {
+        T temp(std::forward<Args>(args)...);
+        push_back(temp);
+        return *ptr<T>(size() - 1);
+    }
+
+    /** @brief Set elemen ke-i dengan value tipe T */
+    template <typename T>
+    requires (list_t::template contains<T>)
+    void assign(size_type i, const T& value) noexcept {
+        std::memcpy(slots_[i].bytes, &value, sizeof(T));
+        tags_[i] = index_of_v<T>;
+    }
+
+    /** @brief Set elemen ke-i dari generic */
+    void assign(size_type i, const value_type& g) noexcept {
+        std::memcpy(slots_[i].bytes, g.data(), max_size);
+        tags_[i] = g.index();
+    }
+
+    void pop_back() noexcept {
+        tags_.pop_back();
+        slots_.pop_back();
+    }
+
+    void clear() noexcept {
+        tags_.clear();
+        slots_.clear();
+    }
+
+    /** @brief Resize, elemen baru valueless */
+    void resize(size_type n) {
+        tags_.resize(n, npos);
+        slots_.resize(n);
+    }
+
+    // ============= Observers =============
+
+    /** @brief Tag elemen ke-i */
+    [[nodiscard]] index_type index(size_type i) const noexcept { return tags_[i]; }
+
+    [[nodiscard]] bool has_value(size_type i) const noexcept { return tags_[i] != npos; }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] bool holds(size_type i) const noexcept {
+        return tags_[i] == index_of_v<T>;
+    }
+
+    /** @brief Semua tag sebagai array padat (untuk scan/filter) */
+    [[nodiscard]] std::span<const index_type> tags() const noexcept { return tags_; }
+
+    /** @brief Jumlah elemen yang menyimpan tipe T */
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] size_type count() const noexcept {
+        size_type c = 0;
+        for (index_type t : tags_) c += (t == index_of_v<T>);
+        return c;
+    }
+
+    // ============= Access =============
+
+    [[nodiscard]] reference operator[](size_type i) noexcept { return reference(this, i); }
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept { return const_reference(this, i); }
+
+    [[nodiscard]] reference at(size_type i) {
+        if (i >= size()) throw std::out_of_range("generic_vector::at");
+        return reference(this, i);
+    }
+
+    [[nodiscard]] const_reference at(size_type i) const {
+        if (i >= size()) throw std::out_of_range("generic_vector::at");
+        return const_reference(this, i);
+    }
+
+    /** @brief Copy elemen ke-i sebagai generic */
+    [[nodiscard]] value_type get(size_type i) const noexcept {
+        return visit_impl<value_type>(*this, i, [](const auto& v) { return value_type(v); });
+    }
+
+    /** @brief Get reference (throws jika tipe salah) */
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] T& get(size_type i) {
+        if (tags_[i] != index_of_v<T>) throw std::bad_cast();
+        return *ptr<T>(i);
+    }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] const T& get(size_type i) const {
+        if (tags_[i] != index_of_v<T>) throw std::bad_cast();
+        return *ptr<T>(i);
+    }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] T& get_unchecked(size_type i) noexcept { return *ptr<T>(i); }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] const T& get_unchecked(size_type i) const noexcept { return *ptr<T>(i); }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] T* get_if(size_type i) noexcept {
+        return tags_[i] == index_of_v<T> ? ptr<T>(i) : nullptr;
+    }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] const T* get_if(size_type i) const noexcept {
+        return tags_[i] == index_of_v<T> ? ptr<T>(i) : nullptr;
+    }
+
+    // ============= Visitation =============
+
+    /** @brief Visit elemen ke-i dengan return value */
+    template <typename F>
+    [[nodiscard]] auto visit(size_type i, F&& f) {
+        using R = std::common_type_t<decltype(f(std::declval<Ts&>()))...>;
+        return visit_impl<R>(*this, i, std::forward<F>(f));
+    }
+
+    template <typename F>
+    [[nodiscard]] auto visit(size_type i, F&& f) const {
+        using R = std::common_type_t<decltype(f(std::declval<const Ts&>()))...>;
+        return visit_impl<R>(*this, i, std::forward<F>(f));
+    }
+
+    /** @brief Visit elemen ke-i tanpa return value */
+    template <typename F>
+    void visit_void(size_type i, F&& f) {
+        visit_impl<void>(*this, i, std::forward<F>(f));
+    }
+
+    template <typename F>
+    void visit_void(size_type i, F&& f) const {
+        visit_impl<void>(*this, i, std::forward<F>(f));
+    }
+
+    // ============= Iterators =============
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(this, 0); }
+    [[nodiscard]] iterator end() noexcept { return iterator(this, size()); }
+    [[nodiscard]] const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(this, size()); }
+    [[nodiscard]] const_iterator cbegin() const noexcept { return begin(); }
+    [[nodiscard]] const_iterator cend() const noexcept { return end(); }
+};
+
+// ============= Reference Proxy =============
+
+/**
+ * @brief Proxy elemen generic_vector dengan API mirip generic
+ * @note Valid selama container tidak realokasi
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+template <bool Const>
+class generic_vector<Ts...>::basic_reference {
+    using container_t = std::conditional_t<Const, const generic_vector, generic_vector>;
+
+    container_t* vec_;
+    size_type i_;
+
+    friend class generic_vector;
+    friend class basic_iterator<Const>;
+
+    basic_reference(container_t* vec, size_type i) noexcept : vec_(vec), i_(i) {}
+
+public:
+    /** @brief Assign generic ke elemen */
+    const basic_reference& operator=(const value_type& g) const noexcept requires (!Const) {
+        vec_->assign(i_, g);
+        return *this;
+    }
+
+    /** @brief Assign value tipe T ke elemen */
+    template <typename T>
+    requires (!Const && list_t::template contains<T>)
+    const basic_reference& operator=(const T& value) const noexcept {
+        vec_->assign(i_, value);
+        return *this;
+    }
+
+    /** @brief Copy sebagai generic */
+    [[nodiscard]] operator value_type() const noexcept { return vec_->get(i_); }
+
+    [[nodiscard]] index_type index() const noexcept { return vec_->index(i_); }
+    [[nodiscard]] bool has_value() const noexcept { return vec_->has_value(i_); }
+    [[nodiscard]] explicit operator bool() const noexcept { return has_value(); }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] bool holds() const noexcept { return vec_->template holds<T>(i_); }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] decltype(auto) get() const { return vec_->template get<T>(i_); }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] decltype(auto) get_unchecked() const noexcept {
+        return vec_->template get_unchecked<T>(i_);
+    }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] auto get_if() const noexcept { return vec_->template get_if<T>(i_); }
+
+    template <typename F>
+    [[nodiscard]] auto visit(F&& f) const { return vec_->visit(i_, std::forward<F>(f)); }
+
+    template <typename F>
+    void visit_void(F&& f) const { vec_->visit_void(i_, std::forward<F>(f)); }
+};
+
+// ============= Iterator =============
+
+/**
+ * @brief Random access iterator yang menghasilkan reference proxy
+ *
+ * iterator_concept = random_access (C++20 ranges). iterator_category hanya
+ * input: reference adalah proxy, bukan value_type&, sehingga tidak memenuhi
+ * syarat LegacyForwardIterator.
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+template <bool Const>
+class generic_vector<Ts...>::basic_iterator {
+    using container_t = std::conditional_t<Const, const generic_vector, generic_vector>;
+
+    container_t* vec_ = nullptr;
+    size_type i_ = 0;
+
+    friend class generic_vector;
+
+    basic_iterator(container_t* vec, size_type i) noexcept : vec_(vec), i_(i) {}
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using iterator_concept = std::random_access_iterator_tag;
+    using value_type = generic_vector::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = basic_reference<Const>;
+
+    basic_iterator() noexcept = default;
+
+    [[nodiscard]] reference operator*() const noexcept { return reference(vec_, i_); }
+    [[nodiscard]] reference operator[](difference_type n) const noexcept {
+        return reference(vec_, i_ + static_cast<size_type>(n));
+    }
+
+    basic_iterator& operator++() noexcept { ++i_; return *this; }
+    basic_iterator operator++(int) noexcept { auto t = *this; ++i_; return t; }
+    basic_iterator& operator--() noexcept { --i_; return *this; }
+    basic_iterator operator--(int) noexcept { auto t = *this; --i_; return t; }
+    basic_iterator& operator+=(difference_type n) noexcept { i_ += static_cast<size_type>(n); return *this; }
+    basic_iterator& operator-=(difference_type n) noexcept { i_ -= static_cast<size_type>(n); return *this; }
+
+    [[nodiscard]] basic_iterator operator+(difference_type n) const noexcept { return {vec_, i_ + static_cast<size_type>(n)}; }
+    [[nodiscard]] basic_iterator operator-(difference_type n) const noexcept { return {vec_, i_ - static_cast<size_type>(n)}; }
+    [[nodiscard]] friend basic_iterator operator+(difference_type n, const basic_iterator& it) noexcept {
+        return it + n;
+    }
+    [[nodiscard]] difference_type operator-(const basic_iterator& o) const noexcept {
+        return static_cast<difference_type>(i_) - static_cast<difference_type>(o.i_);
+    }
+
+    [[nodiscard]] bool operator==(const basic_iterator& o) const noexcept { return i_ == o.i_; }
+    [[nodiscard]] auto operator<=>(const basic_iterator& o) const noexcept { return i_ <=> o.i_; }
+};
+
+// ============= Batch Visitation =============
+
+namespace detail {
+
+/** @brief Jumlah elemen per chunk visit_all (handle + tag muat di L1) */
+inline constexpr size_t visit_all_chunk = 512;
+
+/**
+ * @brief Counting sort satu chunk handle berdasarkan tag, lalu jalankan run
+ *        sekali per bucket tipe: run(index_constant<I>{}, first, last)
+ * @param offsets Scratch minimal N + 1 entry
+ * @note Tag >= N (valueless) dilewati, urutan dalam satu bucket stabil
+ */
+template <size_t N, typename Handle, typename Tag, typename Run>
+void bucket_chunk(const Handle* handles, const Tag* tags, size_t n,
+                  Handle* order, size_t* offsets, Run& run) {
+    std::fill(offsets, offsets + N + 1, size_t{0});
+    for (size_t i = 0; i < n; ++i) {
+        if (static_cast<size_t>(tags[i]) < N) ++offsets[tags[i] + 1];
+    }
+    for (size_t i = 0; i < N; ++i) offsets[i + 1] += offsets[i];
+
+    for (size_t i = 0; i < n; ++i) {
+        if (static_cast<size_t>(tags[i]) < N) order[offsets[tags[i]]++] = handles[i];
+    }
+    // offsets[I] sekarang = akhir bucket I = awal bucket I + 1
+    [&]<size_t... Is>(std::index_sequence<Is...>) {
+        size_t first = 0;
+        ((offsets[Is] != first
+            ? (run(index_constant<Is>{}, order + first, order + offsets[Is]), first = offsets[Is])
+            : first), ...);
+    }(std::make_index_sequence<N>{});
+}
+
+/** @brief visit_all untuk generic_vector: bucket lewat array tag padat */
+template <typename V, typename F>
+void visit_all_soa(V& vec, F& f) {
+    using vec_t = std::remove_const_t<V>;
+    constexpr size_t N = vec_t::type_count;
+
+    const auto tags = vec.tags();
+    size_t handles[visit_all_chunk];
+    size_t order[visit_all_chunk];
+    std::array<size_t, N + 1> offsets;
+
+    auto run = [&](auto I, const size_t* first, const size_t* last) {
+        using T = typename vec_t::list_t::template type<I>;
+        for (; first != last; ++first) f(vec.template get_unchecked<T>(*first));
+    };
+
+    for (size_t base = 0; base < tags.size(); base += visit_all_chunk) {
+        const size_t n = std::min(visit_all_chunk, tags.size() - base);
+        for (size_t i = 0; i < n; ++i) handles[i] = base + i;
+        bucket_chunk<N>(handles, tags.data() + base, n, order, offsets.data(), run);
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Visit semua elemen, dikelompokkan per tipe
+ * @param range Range lvalue generic (mis. std::vector<generic<Ts...>>)
+ * @param f Visitor, dipanggil dengan T& (atau const T&)
+ *
+ * Range diproses per chunk (visit_all_chunk elemen): tiap chunk di-bucket
+ * berdasarkan index() (counting sort atas pointer), lalu f dijalankan pada
+ * tiap bucket homogen dalam loop tanpa dispatch, sehingga kode per-tipe bisa
+ * di-inline dan di-vectorize. Chunk tetap di cache selama semua bucket-nya
+ * dikunjungi, dan tidak ada alokasi per elemen.
+ *
+ * @note Urutan kunjungan: per chunk, lalu per tipe (urutan type list),
+ *       stabil dalam tipe
+ * @note Elemen valueless dilewati
+ */
+template <std::ranges::forward_range Range, typename F>
+requires (is_generic_v<std::ranges::range_value_t<Range>> &&
+          std::is_lvalue_reference_v<std::ranges::range_reference_t<Range>>)
+void visit_all(Range&& range, F&& f) {
+    using elem_t = std::remove_reference_t<std::ranges::range_reference_t<Range>>;
+    using G = std::remove_cv_t<elem_t>;
+    constexpr size_t N = G::type_count;
+    constexpr size_t chunk = detail::visit_all_chunk;
+
+    elem_t* handles[chunk];
+    elem_t* order[chunk];
+    typename G::index_type tags[chunk];
+    std::array<size_t, N + 1> offsets;
+
+    auto run = [&](auto I, elem_t* const* first, elem_t* const* last) {
+        using T = typename G::list_t::template type<I>;
+        for (; first != last; ++first) f((*first)->template get_unchecked<T>());
+    };
+
+    auto it = std::ranges::begin(range);
+    const auto last = std::ranges::end(range);
+    while (it != last) {
+        size_t n = 0;
+        for (; n < chunk && it != last; ++it, ++n) {
+            handles[n] = std::addressof(*it);
+            tags[n] = handles[n]->index();
+        }
+        detail::bucket_chunk<N>(handles, tags, n, order, offsets.data(), run);
+    }
+}
+
+/**
+ * @brief Visit semua elemen generic_vector, dikelompokkan per tipe
+ * @note Bucketing memakai array tag padat, tanpa menyentuh payload
+ */
+template <typename F, typename... Ts>
+void visit_all(generic_vector<Ts...>& vec, F&& f) {
+    detail::visit_all_soa(vec, f);
+}
+
+template <typename F, typename... Ts>
+void visit_all(const generic_vector<Ts...>& vec, F&& f) {
+    detail::visit_all_soa(vec, f);
+}
+
+} // namespace zuu
@@ -0,0 +1,263 @@
+#pragma once
+
+/**
+ * @file hash.hpp
+ * @brief Fast byte-oriented hash untuk generic, bytes dan composer
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - hash_bytes: hash 64-bit kualitas wyhash (multiply-mix 64x64->128)
+ * - hash_value: overload untuk trivially copyable T, generic, bytes, composer
+ *   (struct dengan padding: std::hash<T> atau field_list<T>, konsisten dengan ==)
+ * - std::hash specialization untuk generic<Ts...>, bytes<N>, composer<T>
+ *
+ * @note hash_bytes constexpr; hasil identik di compile-time dan runtime
+ * @note Byte dibaca sebagai little-endian sehingga hasil sama di semua platform
+ */
+
+#include "bytes.hpp"
+#include "composer.hpp"
+#include "endian.hpp"
+#include "generic.hpp"
+#include "layout.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace zuu {
+
+namespace detail {
+
+/** @brief Konstanta secret wyhash */
+inline constexpr uint64_t hash_secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+/** @brief 64x64 -> 128 multiply, hasil (lo, hi) ditulis ke a, b */
+constexpr void hash_mum(uint64_t& a, uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    const uint128_t r = static_cast<uint128_t>(a) * b;
+    a = static_cast<uint64_t>(r);
+    b = static_cast<uint64_t>(r >> 64);
+#else
+    const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+    const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const uint64_t t = rl + (rm0 << 32);
+    uint64_t c = t < rl;
+    const uint64_t lo = t + (rm1 << 32);
+    c += lo < t;
+    a = lo;
+    b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+[[nodiscard]] constexpr uint64_t hash_mix(uint64_t a, uint64_t b) noexcept {
+    hash_mum(a, b);
+    return a ^ b;
+}
+
+/** @brief Load N byte little-endian (unaligned) */
+template <size_t N>
+[[nodiscard]] constexpr uint64_t hash_read(const uint8_t* p) noexcept {
+    if (std::is_constant_evaluated()) {
+        uint64_t v = 0;
+        for (size_t i = 0; i < N; ++i) v |= static_cast<uint64_t>(p[i]) << (i * 8);
+        return v;
+    } else {
+        std::conditional_t<N == 8, uint64_t, uint32_t> v;
+        std::memcpy(&v, p, N);
+        return zuu::from_little_endian(v);
+    }
+}
+
+/** @brief Load 1-3 byte */
+[[nodiscard]] constexpr uint64_t hash_read3(const uint8_t* p, size_t k) noexcept {
+    return (static_cast<uint64_t>(p[0]) << 16) |
+           (static_cast<uint64_t>(p[k >> 1]) << 8) |
+           p[k - 1];
+}
+
+} // namespace detail
+
+// ============= Byte Hash =============
+
+/**
+ * @brief Hash 64-bit untuk byte array (algoritma wyhash)
+ * @param data Pointer ke data
+ * @param len Panjang dalam bytes
+ * @param seed Seed (default 0)
+ *
+ * Input > 48 bytes diproses 48 bytes per iterasi dengan tiga lane independen
+ * sehingga multiply bisa berjalan paralel (ILP).
+ */
+[[nodiscard]] constexpr uint64_t hash_bytes(const uint8_t* data, size_t len, uint64_t seed = 0) noexcept {
+    using detail::hash_secret;
+    using detail::hash_mix;
+    using detail::hash_read;
+
+    const uint8_t* p = data;
+    seed ^= hash_mix(seed ^ hash_secret[0], hash_secret[1]);
+    uint64_t a = 0, b = 0;
+
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t off = (len >> 3) << 2;
+            a = (hash_read<4>(p) << 32) | hash_read<4>(p + off);
+            b = (hash_read<4>(p + len - 4) << 32) | hash_read<4>(p + len - 4 - off);
+        } else if (len > 0) {
+            a = detail::hash_read3(p, len);
+        }
+    } else {
+        size_t i = len;
+        if (i > 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = hash_mix(hash_read<8>(p) ^ hash_secret[1], hash_read<8>(p + 8) ^ seed);
+                see1 = hash_mix(hash_read<8>(p + 16) ^ hash_secret[2], hash_read<8>(p + 24) ^ see1);
+                see2 = hash_mix(hash_read<8>(p + 32) ^ hash_secret[3], hash_read<8>(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = hash_mix(hash_read<8>(p) ^ hash_secret[1], hash_read<8>(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = hash_read<8>(p + i - 16);
+        b = hash_read<8>(p + i - 8);
+    }
+
+    a ^= hash_secret[1];
+    b ^= seed;
+    detail::hash_mum(a, b);
+    return hash_mix(a ^ hash_secret[0] ^ len, b ^ hash_secret[1]);
+}
+
+/** @brief Hash untuk satu integer 64-bit (tanpa melewati byte array) */
+[[nodiscard]] constexpr uint64_t hash_u64(uint64_t v, uint64_t seed = 0) noexcept {
+    return detail::hash_mix(v ^ detail::hash_secret[0], seed ^ detail::hash_secret[1]);
+}
+
+// ============= Value Hash =============
+
+/**
+ * @brief Hash object representation dari T
+ *
+ * Konsisten dengan operator== generic (lihat detail::equal_value):
+ * - Tipe dengan unique object representation: hash langsung sizeof(T) bytes
+ * - Floating point: +0.0 dan -0.0 di-hash sama
+ * - Tanpa operator== (dibandingkan dengan memcmp): sizeof(T) bytes
+ * - Lainnya (struct dengan padding / float): std::hash<T> jika ada, selain
+ *   itu field di field_list<T>; padding tidak pernah ikut di-hash.
+ *   Tanpa keduanya: compile error
+ */
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+[[nodiscard]] uint64_t hash_value(const T& value, uint64_t seed = 0) noexcept;
+
+namespace detail {
+
+/** @brief Hash field V (scalar, array, atau struct) dengan seed berantai */
+template <typename V>
+[[nodiscard]] uint64_t hash_field(const V& v, uint64_t seed) noexcept {
+    if constexpr (std::is_bounded_array_v<V> && !std::has_unique_object_representations_v<V>) {
+        for (const auto& e : v) seed = hash_field(e, seed);
+        return seed;
+    } else {
+        return hash_value(v, seed);
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+requires std::is_trivially_copyable_v<T>
+[[nodiscard]] uint64_t hash_value(const T& value, uint64_t seed) noexcept {
+    if constexpr (std::is_floating_point_v<T>) {
+        const T v = value == T{} ? T{} : value;
+        return hash_bytes(reinterpret_cast<const uint8_t*>(&v), sizeof(T), seed);
+    } else if constexpr (std::has_unique_object_representations_v<T> || !std::equality_comparable<T>) {
+        return hash_bytes(reinterpret_cast<const uint8_t*>(&value), sizeof(T), seed);
+    } else if constexpr (std::is_default_constructible_v<std::hash<T>>) {
+        return hash_u64(static_cast<uint64_t>(std::hash<T>{}(value)), seed);
+    } else if constexpr (described_struct<T>) {
+        uint64_t h = hash_u64(sizeof(T), seed);
+        detail::visit_fields<T>([&](auto m) {
+            detail::with_field<m.value>(value, [&](const auto& f) { h = detail::hash_field(f, h); });
+        });
+        return h;
+    } else {
+        static_assert(described_struct<T>,
+            "hash_value: T punya padding / float dan operator==; sediakan std::hash<T> atau field_list<T>");
+        return 0;
+    }
+}
+
+/** @brief Hash bytes<N> (constexpr) */
+template <size_t N>
+[[nodiscard]] constexpr uint64_t hash_value(const bytes<N>& b, uint64_t seed = 0) noexcept {
+    return hash_bytes(b.data(), N, seed);
+}
+
+/** @brief Hash composer<T> (sama dengan hash_value(T)) */
+template <typename T>
+[[nodiscard]] uint64_t hash_value(const composer<T>& c, uint64_t seed = 0) noexcept {
+    return hash_value(c.value(), seed);
+}
+
+/**
+ * @brief Hash generic: tag + alternatif aktif
+ * @note Valueless menghasilkan hash dari tag npos saja
+ */
+template <typename... Ts>
+[[nodiscard]] uint64_t hash_value(const generic<Ts...>& g, uint64_t seed = 0) noexcept {
+    const uint64_t tagged = seed ^ hash_u64(g.index());
+    if (!g.has_value()) return tagged;
+    return g.visit([&](const auto& v) { return hash_value(v, tagged); });
+}
+
+/**
+ * @brief Hasher transparan untuk unordered container
+ * @example
+ * ```cpp
+ * std::unordered_map<generic<int, double>, int, zuu::hasher> m;
+ * ```
+ */
+struct hasher {
+    using is_transparent = void;
+
+    template <typename T>
+    [[nodiscard]] size_t operator()(const T& value) const noexcept {
+        return static_cast<size_t>(hash_value(value));
+    }
+};
+
+} // namespace zuu
+
+// ============= std::hash Specializations =============
+
+template <typename... Ts>
+struct std::hash<zuu::generic<Ts...>> {
+    [[nodiscard]] size_t operator()(const zuu::generic<Ts...>& g) const noexcept {
+        return static_cast<size_t>(zuu::hash_value(g));
+    }
+};
+
+template <size_t N>
+struct std::hash<zuu::bytes<N>> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::bytes<N>& b) const noexcept {
+        return static_cast<size_t>(zuu::hash_value(b));
+    }
+};
+
+template <typename T>
+struct std::hash<zuu::composer<T>> {
+    [[nodiscard]] size_t operator()(const zuu::composer<T>& c) const noexcept {
+        return static_cast<size_t>(zuu::hash_value(c));
+    }
+};
@@ -0,0 +1,809 @@
+#pragma once
+
+/**
+ * @file layout.hpp
+ * @brief Deskripsi field struct untuk konversi endian per field
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - fields<&T::a, &T::b, ...>: daftar field (member pointer)
+ * - field_list<T>: trait yang di-specialize user untuk struct T
+ * - field_offset<M>: offset field compile-time (tanpa offsetof maupun bit_cast class)
+ * - field_swap_mask<T>: permutasi byte compile-time untuk byte_swap T
+ * - byte_swap / to_big_endian / ... untuk struct yang dideskripsikan
+ * - bulk_byte_swap_fields: swap per field untuk array struct (pshufb per blok)
+ * - wire_layout<T> / wire_pack / wire_unpack: bentuk wire packed (tanpa padding)
+ *   dengan endianness per field, straight-line tanpa loop runtime
+ *
+ * Field boleh berupa scalar (lihat byte_swap), array scalar, atau struct lain
+ * yang juga punya field_list. Byte yang tidak tercakup field (padding, field
+ * yang tidak didaftarkan) tidak diubah.
+ *
+ * @example
+ * ```cpp
+ * struct header { uint32_t id; uint16_t len; float scale; uint8_t mac[6]; };
+ * template <> struct zuu::field_list<header>
+ *     : zuu::fields<&header::id, &header::len, &header::scale, &header::mac> {};
+ *
+ * composer<header> c(h);
+ * auto wire = c.to_network();   // id, len, scale di-swap per field
+ * ```
+ */
+
+#include "endian.hpp"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+// ============= Field Descriptor =============
+
+/**
+ * @brief Daftar field struct sebagai member pointer
+ * @note Urutan bebas; offset dihitung dari member pointer, bukan dari urutan
+ */
+template <auto... Members>
+requires (std::is_member_object_pointer_v<decltype(Members)> && ...)
+struct fields {
+    using fields_type = fields;
+    static constexpr size_t count = sizeof...(Members);
+};
+
+/**
+ * @brief Field list untuk T; specialize dengan mewarisi fields<...>
+ * @example
+ * ```cpp
+ * template <> struct zuu::field_list<point> : zuu::fields<&point::x, &point::y> {};
+ * ```
+ */
+template <typename T>
+struct field_list {};
+
+namespace detail {
+
+template <typename M>
+struct member_pointer_traits;
+
+template <typename C, typename V>
+struct member_pointer_traits<V C::*> {
+    using class_type = C;
+    using value_type = V;
+};
+
+template <auto M>
+using member_class_t = typename member_pointer_traits<std::remove_cv_t<decltype(M)>>::class_type;
+
+template <auto M>
+using member_value_t = typename member_pointer_traits<std::remove_cv_t<decltype(M)>>::value_type;
+
+template <typename T, typename F>
+struct fields_belong_to : std::false_type {};
+
+template <typename T, auto... Ms>
+struct fields_belong_to<T, fields<Ms...>>
+    : std::bool_constant<(std::is_same_v<member_class_t<Ms>, T> && ...)> {};
+
+} // namespace detail
+
+/** @brief Struct trivially copyable dengan field_list<T> */
+template <typename T>
+concept described_struct = std::is_class_v<T> && std::is_trivially_copyable_v<T> &&
+    requires { typename field_list<T>::fields_type; } &&
+    detail::fields_belong_to<T, typename field_list<T>::fields_type>::value;
+
+namespace detail {
+
+/** @brief Panggil f(std::integral_constant<M>) untuk setiap field T */
+template <described_struct T, typename F>
+constexpr void visit_fields(F&& f) {
+    [&]<auto... Ms>(fields<Ms...>) {
+        (f(std::integral_constant<decltype(Ms), Ms>{}), ...);
+    }(typename field_list<T>::fields_type{});
+}
+
+/** @brief Tipe yang boleh menjadi field: scalar, array-nya, atau described struct */
+template <typename V>
+struct endian_field : std::bool_constant<byte_swap_scalar<V>> {};
+
+template <typename V, size_t N>
+struct endian_field<V[N]> : endian_field<V> {};
+
+template <described_struct V>
+struct endian_field<V> {
+    static constexpr bool value = [] {
+        bool ok = true;
+        visit_fields<V>([&](auto m) { ok = ok && endian_field<member_value_t<m.value>>::value; });
+        return ok;
+    }();
+};
+
+/** @brief Byte ke-i berisi (i >> shift) & 0xFF; untuk membaca offset field */
+template <typename T>
+[[nodiscard]] constexpr std::array<uint8_t, sizeof(T)> offset_probe(unsigned shift) noexcept {
+    std::array<uint8_t, sizeof(T)> a{};
+    for (size_t i = 0; i < sizeof(T); ++i) a[i] = static_cast<uint8_t>(i >> shift);
+    return a;
+}
+
+/**
+ * @brief Offset member m di C tanpa membuat objek C
+ *
+ * C ditaruh di union bersama char[sizeof(C)] yang aktif; alamat field
+ * dibandingkan dengan alamat tiap byte, tidak ada nilai C yang dibaca.
+ */
+template <typename C, typename V>
+[[nodiscard]] consteval size_t member_offset(V C::* m) noexcept {
+    union storage {
+        char bytes[sizeof(C)];
+        C obj;
+        constexpr storage() : bytes{} {}
+        constexpr ~storage() {}
+    } u;
+    const void* target = &(u.obj.*m);
+    for (size_t i = 0; i < sizeof(C); ++i)
+        if (static_cast<const void*>(&u.bytes[i]) == target) return i;
+    return sizeof(C);
+}
+
+/** @brief member_offset(M) bisa dievaluasi compile-time oleh compiler ini */
+template <auto M>
+concept member_offset_constant =
+    requires { typename std::integral_constant<size_t, member_offset(M)>; };
+
+/**
+ * @brief Class yang bisa di-probe lewat std::bit_cast
+ * @note Semua member (termasuk yang tidak didaftarkan) harus bit_cast-able:
+ *       tanpa pointer, reference, union, atau member pointer
+ */
+template <typename C>
+concept bit_cast_probeable = std::is_trivially_copyable_v<C> && sizeof(C) <= 0xFFFF;
+
+/**
+ * @brief Baca index probe di byte pertama yang bukan padding dari v
+ * @return {index probe, offset byte tersebut di dalam V}
+ */
+template <typename V>
+[[nodiscard]] constexpr std::pair<size_t, size_t> probe_first(const V& lo, const V& hi) noexcept;
+
+} // namespace detail
+
+/**
+ * @brief Offset field M di dalam class-nya (compile-time)
+ *
+ * Dihitung dari alamat member di dalam union, tanpa bit_cast, sehingga member
+ * pointer / reference / union di class tidak masalah. Compiler yang tidak bisa
+ * membandingkan alamat tersebut saat compile-time memakai fallback: std::bit_cast
+ * probe berisi index byte ke struct lalu membaca kembali byte field tersebut;
+ * class harus trivially copyable dan seluruh member-nya bit_cast-able.
+ */
+template <auto M>
+requires std::is_member_object_pointer_v<decltype(M)> &&
+         (detail::member_offset_constant<M> ||
+          detail::bit_cast_probeable<detail::member_class_t<M>>)
+inline constexpr size_t field_offset = [] {
+    using C = detail::member_class_t<M>;
+    if constexpr (detail::member_offset_constant<M>) {
+        return detail::member_offset(M);
+    } else {
+        const C lo = std::bit_cast<C>(detail::offset_probe<C>(0));
+        const C hi = std::bit_cast<C>(detail::offset_probe<C>(8));
+        const auto [index, inner] = detail::probe_first(lo.*M, hi.*M);
+        return index - inner;
+    }
+}();
+
+namespace detail {
+
+template <typename V>
+constexpr std::pair<size_t, size_t> probe_first(const V& lo, const V& hi) noexcept {
+    if constexpr (std::is_bounded_array_v<V>) {
+        return probe_first(lo[0], hi[0]);
+    } else if constexpr (described_struct<V>) {
+        // Field dengan offset terkecil; byte pertamanya bukan padding
+        std::pair<size_t, size_t> best{0, sizeof(V)};
+        visit_fields<V>([&](auto m) {
+            constexpr size_t off = field_offset<m.value>;
+            if (off < best.second) {
+                const auto [index, inner] = probe_first(lo.*(m.value), hi.*(m.value));
+                best = {index, off + inner};
+            }
+        });
+        return best;
+    } else {
+        const auto l = std::bit_cast<std::array<uint8_t, sizeof(V)>>(lo);
+        const auto h = std::bit_cast<std::array<uint8_t, sizeof(V)>>(hi);
+        return { static_cast<size_t>(l[0]) | (static_cast<size_t>(h[0]) << 8), 0 };
+    }
+}
+
+/** @brief f(offset, size) untuk setiap scalar leaf di dalam V mulai dari base */
+template <typename V, typename F>
+constexpr void for_each_leaf(size_t base, F& f) {
+    if constexpr (byte_swap_scalar<V>) {
+        f(base, sizeof(V));
+    } else if constexpr (std::is_bounded_array_v<V>) {
+        using E = std::remove_extent_t<V>;
+        for (size_t i = 0; i < std::extent_v<V>; ++i) for_each_leaf<E>(base + i * sizeof(E), f);
+    } else {
+        visit_fields<V>([&](auto m) {
+            for_each_leaf<member_value_t<m.value>>(base + field_offset<m.value>, f);
+        });
+    }
+}
+
+/** @brief Swap byte setiap leaf V yang tersimpan di p (tanpa syarat alignment) */
+template <typename V>
+inline void swap_field_bytes(uint8_t* p) noexcept {
+    auto f = [p](size_t off, size_t size) {
+        auto swap = [&]<size_t N>(std::integral_constant<size_t, N>) {
+            if constexpr (N > 1) {
+                uint_of_size<N> x;
+                std::memcpy(&x, p + off, N);
+                x = byte_swap(x);
+                std::memcpy(p + off, &x, N);
+            }
+        };
+        switch (size) {
+            case 2: swap(std::integral_constant<size_t, 2>{}); break;
+            case 4: swap(std::integral_constant<size_t, 4>{}); break;
+            case 8: swap(std::integral_constant<size_t, 8>{}); break;
+#if defined(__SIZEOF_INT128__)
+            case 16: swap(std::integral_constant<size_t, 16>{}); break;
+#endif
+            default: break;
+        }
+    };
+    for_each_leaf<V>(0, f);
+}
+
+/** @brief true jika field M ter-align (bukan member struct packed) */
+template <auto M>
+inline constexpr bool field_aligned =
+    field_offset<M> % alignof(member_value_t<M>) == 0 &&
+    alignof(member_class_t<M>) >= alignof(member_value_t<M>);
+
+/** @brief Swap byte setiap leaf di dalam v (straight-line setelah inlining) */
+template <typename V>
+constexpr void swap_field_value(V& v) noexcept {
+    if constexpr (byte_swap_scalar<V>) {
+        v = byte_swap(v);
+    } else if constexpr (std::is_bounded_array_v<V>) {
+        // Di-unroll compile-time agar struct tetap bisa di-scalarize compiler
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (swap_field_value(v[I]), ...);
+        }(std::make_index_sequence<std::extent_v<V>>{});
+    } else {
+        visit_fields<V>([&](auto m) {
+            // Field packed tidak boleh diakses lewat reference (misaligned)
+            if constexpr (field_aligned<m.value>) {
+                swap_field_value(v.*(m.value));
+            } else if (std::is_constant_evaluated()) {
+                swap_field_value(v.*(m.value));
+            } else {
+                swap_field_bytes<member_value_t<m.value>>(
+                    reinterpret_cast<uint8_t*>(&v) + field_offset<m.value>);
+            }
+        });
+    }
+}
+
+} // namespace detail
+
+/** @brief Struct yang seluruh field-nya bisa dikonversi endian */
+template <typename T>
+concept endian_struct = described_struct<T> && detail::endian_field<T>::value;
+
+/** @brief Scalar (lihat byte_swap) atau endian_struct */
+template <typename T>
+concept endian_convertible = detail::byte_swap_scalar<T> || endian_struct<T>;
+
+/**
+ * @brief Permutasi byte untuk byte_swap T: hasil[i] = src[mask[i]]
+ * @note Padding dan byte di luar field dipetakan ke dirinya sendiri
+ */
+template <endian_struct T>
+inline constexpr auto field_swap_mask = [] {
+    std::array<uint16_t, sizeof(T)> m{};
+    for (size_t i = 0; i < sizeof(T); ++i) m[i] = static_cast<uint16_t>(i);
+    auto f = [&](size_t off, size_t size) {
+        for (size_t j = 0; j < size; ++j) m[off + j] = static_cast<uint16_t>(off + size - 1 - j);
+    };
+    detail::for_each_leaf<T>(0, f);
+    return m;
+}();
+
+namespace detail {
+
+#if defined(ZUU_ENDIAN_SSSE3)
+/** @brief field_swap_mask<T> dalam format pshufb (T <= 16 byte, sisa lane = 0x80) */
+template <endian_struct T>
+requires (sizeof(T) <= 16)
+inline constexpr auto field_shuffle16 = [] {
+    struct { alignas(16) uint8_t v[16]; } m{};
+    for (size_t i = 0; i < 16; ++i)
+        m.v[i] = i < sizeof(T) ? static_cast<uint8_t>(field_swap_mask<T>[i]) : uint8_t{0x80};
+    return m;
+}();
+#endif
+
+} // namespace detail
+
+// ============= Struct Endian Conversion =============
+
+/**
+ * @brief Swap byte setiap field T in-place
+ *
+ * T 8 atau 16 byte dengan SSSE3: satu pshufb dengan field_swap_mask<T>.
+ * Selain itu satu bswap per field (straight-line, tanpa loop runtime).
+ */
+template <endian_struct T>
+constexpr void byte_swap_fields(T& v) noexcept {
+#if defined(ZUU_ENDIAN_SSSE3)
+    // Hanya 8 / 16 byte: ukuran lain butuh buffer, dan store sempit lalu load
+    // 16 byte gagal store-forwarding (lebih lambat dari bswap per field)
+    if constexpr (sizeof(T) == 16 || sizeof(T) == 8) {
+        if (!std::is_constant_evaluated()) {
+            auto* p = reinterpret_cast<__m128i*>(&v);
+            const __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(detail::field_shuffle16<T>.v));
+            if constexpr (sizeof(T) == 16) _mm_storeu_si128(p, _mm_shuffle_epi8(_mm_loadu_si128(p), m));
+            else _mm_storel_epi64(p, _mm_shuffle_epi8(_mm_loadl_epi64(p), m));
+            return;
+        }
+    }
+#endif
+    detail::swap_field_value(v);
+}
+
+/** @brief byte_swap untuk endian_struct: swap per field, bukan seluruh object */
+template <endian_struct T>
+[[nodiscard]] constexpr T byte_swap(T v) noexcept {
+    byte_swap_fields(v);
+    return v;
+}
+
+/** @brief Native -> little-endian per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T to_little_endian(T v) noexcept {
+    if constexpr (!is_little_endian) byte_swap_fields(v);
+    return v;
+}
+
+/** @brief Native -> big-endian per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T to_big_endian(T v) noexcept {
+    if constexpr (!is_big_endian) byte_swap_fields(v);
+    return v;
+}
+
+/** @brief Little-endian -> native per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T from_little_endian(T v) noexcept { return to_little_endian(v); }
+
+/** @brief Big-endian -> native per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T from_big_endian(T v) noexcept { return to_big_endian(v); }
+
+/** @brief Native -> endianness runtime per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T to_endian(T v, endian_t target) noexcept {
+    if (target != native_endian) byte_swap_fields(v);
+    return v;
+}
+
+/** @brief Endianness runtime -> native per field */
+template <endian_struct T>
+[[nodiscard]] constexpr T from_endian(T v, endian_t source) noexcept { return to_endian(v, source); }
+
+// ============= Bulk Struct Conversion =============
+
+namespace detail {
+
+/** @brief Panjang blok mask bulk: lcm(sizeof(T), 64) byte */
+template <endian_struct T>
+inline constexpr size_t field_block = std::lcm(sizeof(T), size_t{64});
+
+/**
+ * @brief true jika tidak ada leaf yang melewati batas lane 16 byte pada posisi
+ *        elemen mana pun di dalam blok (syarat pshufb per lane), blok <= 512 byte
+ */
+template <endian_struct T>
+inline constexpr bool field_lane_local = [] {
+    if (field_block<T> > 512) return false;
+    bool ok = true;
+    auto f = [&](size_t off, size_t size) {
+        for (size_t k = off; k < field_block<T>; k += sizeof(T))
+            ok = ok && k / 16 == (k + size - 1) / 16;
+    };
+    for_each_leaf<T>(0, f);
+    return ok;
+}();
+
+/** @brief field_swap_mask<T> diulang sepanjang satu blok, index relatif lane 16 byte */
+template <endian_struct T>
+requires field_lane_local<T>
+inline constexpr auto field_shuffle_block = [] {
+    struct { alignas(64) uint8_t v[field_block<T>]; } m{};
+    for (size_t i = 0; i < field_block<T>; ++i) {
+        const size_t src = i / sizeof(T) * sizeof(T) + field_swap_mask<T>[i % sizeof(T)];
+        m.v[i] = static_cast<uint8_t>(src - i / 16 * 16);
+    }
+    return m;
+}();
+
+#if defined(ZUU_ENDIAN_SSSE3)
+/**
+ * @brief Swap field array T sepanjang n byte dari src ke dst (boleh sama)
+ *
+ * Blok penuh per 64 B (AVX-512BW / 2x AVX2 / 4x SSSE3), sisa per lane 16 B,
+ * lane terakhir yang tidak penuh lewat buffer. Setiap leaf berada di dalam
+ * satu lane, jadi lane boleh memotong batas elemen.
+ */
+template <endian_struct T>
+requires field_lane_local<T>
+inline void bulk_swap_fields_kernel(uint8_t* dst, const uint8_t* src, size_t n) noexcept {
+    constexpr size_t block = field_block<T>;
+    const uint8_t* mask = field_shuffle_block<T>.v;
+    size_t i = 0;
+    for (; i + block <= n; i += block) {
+        for (size_t j = 0; j < block; j += 64) {
+#if defined(ZUU_ENDIAN_AVX512BW)
+            const __m512i x = _mm512_loadu_si512(src + i + j);
+            _mm512_storeu_si512(dst + i + j, _mm512_shuffle_epi8(x, _mm512_load_si512(mask + j)));
+#elif defined(ZUU_ENDIAN_AVX2)
+            for (size_t k = j; k < j + 64; k += 32) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + k));
+                const __m256i m = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask + k));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + k), _mm256_shuffle_epi8(x, m));
+            }
+#else
+            for (size_t k = j; k < j + 64; k += 16) {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + k));
+                const __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(mask + k));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + k), _mm_shuffle_epi8(x, m));
+            }
+#endif
+        }
+    }
+    // Sisa < 1 blok dimulai di awal blok, jadi mask dibaca dari offset 0
+    size_t j = 0;
+    for (; i + 16 <= n; i += 16, j += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(mask + j));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_shuffle_epi8(x, m));
+    }
+    if (i < n) {
+        alignas(16) uint8_t buf[16] = {};
+        std::memcpy(buf, src + i, n - i);
+        const __m128i x = _mm_load_si128(reinterpret_cast<const __m128i*>(buf));
+        const __m128i m = _mm_load_si128(reinterpret_cast<const __m128i*>(mask + j));
+        _mm_store_si128(reinterpret_cast<__m128i*>(buf), _mm_shuffle_epi8(x, m));
+        std::memcpy(dst + i, buf, n - i);
+    }
+}
+#endif
+
+/** @brief dst[i] = byte_swap(src[i]) per field, count elemen; constexpr-aware */
+template <endian_struct T>
+constexpr void bulk_swap_fields(T* dst, const T* src, size_t count) noexcept {
+#if defined(ZUU_ENDIAN_SSSE3)
+    if constexpr (field_lane_local<T>) {
+        if (!std::is_constant_evaluated()) {
+            bulk_swap_fields_kernel<T>(reinterpret_cast<uint8_t*>(dst),
+                                       reinterpret_cast<const uint8_t*>(src), count * sizeof(T));
+            return;
+        }
+    }
+#endif
+    // Salin dulu (memcpy) agar padding ikut, lalu swap in-place
+    bulk_copy(dst, src, count);
+    for (size_t i = 0; i < count; ++i) byte_swap_fields(dst[i]);
+}
+
+} // namespace detail
+
+/**
+ * @brief Swap per field setiap elemen array struct in-place
+ *
+ * Dengan SSSE3 dan layout yang tidak memotong lane 16 byte (cek
+ * detail::field_lane_local<T>): satu pshufb per 16 byte memakai
+ * field_swap_mask<T> yang diulang per blok lcm(sizeof(T), 64).
+ * Selain itu byte_swap_fields per elemen.
+ *
+ * @note Untuk array scalar gunakan bulk_byte_swap (endian.hpp)
+ */
+template <endian_struct T>
+constexpr void bulk_byte_swap_fields(std::span<T> data) noexcept {
+    detail::bulk_swap_fields(data.data(), data.data(), data.size());
+}
+
+/**
+ * @brief dst[i] = byte_swap(src[i]) per field (copy-converting)
+ * @note Memproses min(src.size(), dst.size()) elemen
+ */
+template <endian_struct T>
+constexpr void bulk_byte_swap_fields(std::span<const T> src, std::span<T> dst) noexcept {
+    detail::bulk_swap_fields(dst.data(), src.data(), src.size() < dst.size() ? src.size() : dst.size());
+}
+
+// ============= Wire Layout =============
+
+/**
+ * @brief Field wire: member pointer + byte order di wire
+ * @note E berlaku untuk scalar dan array scalar; field struct memakai
+ *       wire_layout struct tersebut
+ */
+template <auto Member, endian_t E = endian_t::big>
+requires std::is_member_object_pointer_v<decltype(Member)>
+struct wire_field {
+    static constexpr auto member = Member;
+    static constexpr endian_t endian = E;
+};
+
+template <auto Member>
+using be_field = wire_field<Member, endian_t::big>;
+
+template <auto Member>
+using le_field = wire_field<Member, endian_t::little>;
+
+/** @brief Daftar field wire; urutan daftar = urutan di wire, tanpa padding */
+template <typename... Fields>
+struct wire_fields {
+    using wire_fields_type = wire_fields;
+    static constexpr size_t count = sizeof...(Fields);
+};
+
+/**
+ * @brief Layout wire untuk T
+ *
+ * Default untuk struct dengan field_list<T>: urutan yang sama, semua
+ * big-endian (network order). Specialize untuk urutan / endianness lain.
+ *
+ * @example
+ * ```cpp
+ * template <> struct zuu::wire_layout<record>
+ *     : zuu::wire_fields<zuu::be_field<&record::id>, zuu::le_field<&record::crc>> {};
+ * ```
+ */
+template <typename T>
+struct wire_layout {};
+
+namespace detail {
+
+template <typename F>
+struct default_wire_fields {};
+
+template <auto... Ms>
+struct default_wire_fields<fields<Ms...>> : wire_fields<wire_field<Ms>...> {};
+
+} // namespace detail
+
+template <described_struct T>
+struct wire_layout<T> : detail::default_wire_fields<typename field_list<T>::fields_type> {};
+
+namespace detail {
+
+template <typename F, typename T>
+struct is_wire_field_of : std::false_type {};
+
+template <auto M, endian_t E, typename T>
+struct is_wire_field_of<wire_field<M, E>, T> : std::is_same<member_class_t<M>, T> {};
+
+template <typename T, typename L>
+struct wire_fields_belong_to : std::false_type {};
+
+template <typename T, typename... Fs>
+struct wire_fields_belong_to<T, wire_fields<Fs...>> : std::conjunction<is_wire_field_of<Fs, T>...> {};
+
+} // namespace detail
+
+/** @brief Struct trivially copyable dengan wire_layout<T> */
+template <typename T>
+concept wire_described = std::is_class_v<T> && std::is_trivially_copyable_v<T> &&
+    requires { typename wire_layout<T>::wire_fields_type; } &&
+    detail::wire_fields_belong_to<T, typename wire_layout<T>::wire_fields_type>::value;
+
+namespace detail {
+
+/** @brief Tipe yang boleh menjadi field wire: scalar, array-nya, atau wire struct */
+template <typename V>
+struct wire_value : std::bool_constant<byte_swap_scalar<V>> {};
+
+template <typename V, size_t N>
+struct wire_value<V[N]> : wire_value<V> {};
+
+template <wire_described V>
+struct wire_value<V> {
+    static constexpr bool value = []<typename... Fs>(wire_fields<Fs...>) {
+        return (wire_value<member_value_t<Fs::member>>::value && ...);
+    }(typename wire_layout<V>::wire_fields_type{});
+};
+
+} // namespace detail
+
+/** @brief Struct yang bisa di-pack ke bentuk wire */
+template <typename T>
+concept wire_struct = wire_described<T> && detail::wire_value<T>::value;
+
+namespace detail {
+
+template <typename V>
+constexpr size_t wire_value_size() noexcept;
+
+template <typename T>
+constexpr size_t wire_struct_size() noexcept {
+    return []<typename... Fs>(wire_fields<Fs...>) {
+        return (size_t{0} + ... + wire_value_size<member_value_t<Fs::member>>());
+    }(typename wire_layout<T>::wire_fields_type{});
+}
+
+template <typename V>
+constexpr size_t wire_value_size() noexcept {
+    if constexpr (byte_swap_scalar<V>) return sizeof(V);
+    else if constexpr (std::is_bounded_array_v<V>)
+        return std::extent_v<V> * wire_value_size<std::remove_extent_t<V>>();
+    else return wire_struct_size<V>();
+}
+
+/** @brief Offset wire setiap field T (prefix sum ukuran wire) */
+template <typename T>
+inline constexpr auto wire_offsets = []<typename... Fs>(wire_fields<Fs...>) {
+    std::array<size_t, sizeof...(Fs)> o{};
+    size_t at = 0, i = 0;
+    ((o[i++] = at, at += wire_value_size<member_value_t<Fs::member>>()), ...);
+    return o;
+}(typename wire_layout<T>::wire_fields_type{});
+
+} // namespace detail
+
+/** @brief Deskripsi satu field wire */
+struct wire_field_info {
+    size_t offset;       ///< Offset di struct native
+    size_t wire_offset;  ///< Offset di wire (packed)
+    size_t size;         ///< Ukuran di wire
+    endian_t endian;     ///< Byte order di wire (field struct: lihat layout-nya)
+};
+
+/** @brief Ukuran bentuk wire T (jumlah ukuran field, tanpa padding) */
+template <wire_struct T>
+inline constexpr size_t wire_size = detail::wire_struct_size<T>();
+
+/** @brief Deskripsi compile-time seluruh field wire T, urut sesuai wire */
+template <wire_struct T>
+inline constexpr auto wire_info = []<typename... Fs>(wire_fields<Fs...>) {
+    std::array<wire_field_info, sizeof...(Fs)> r{};
+    size_t i = 0;
+    ((r[i] = { field_offset<Fs::member>, detail::wire_offsets<T>[i],
+               detail::wire_value_size<detail::member_value_t<Fs::member>>(), Fs::endian }, ++i), ...);
+    return r;
+}(typename wire_layout<T>::wire_fields_type{});
+
+namespace detail {
+
+template <typename T>
+inline void wire_pack_into(const T& v, uint8_t* p) noexcept;
+
+template <typename T>
+inline void wire_unpack_into(const uint8_t* p, T& v) noexcept;
+
+/** @brief f(field M dari v); field packed dibaca lewat salinan ter-align */
+template <auto M, typename C, typename F>
+inline void with_field(const C& v, F&& f) noexcept {
+    if constexpr (field_aligned<M>) {
+        f(v.*M);
+    } else {
+        member_value_t<M> tmp;
+        std::memcpy(&tmp, reinterpret_cast<const uint8_t*>(&v) + field_offset<M>, sizeof(tmp));
+        f(static_cast<const member_value_t<M>&>(tmp));
+    }
+}
+
+template <endian_t E, typename V>
+inline void wire_put(uint8_t* p, const V& v) noexcept {
+    if constexpr (byte_swap_scalar<V>) {
+        store_endian<E, V>(p, v);
+    } else if constexpr (std::is_bounded_array_v<V>) {
+        constexpr size_t step = wire_value_size<std::remove_extent_t<V>>();
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (wire_put<E>(p + I * step, v[I]), ...);
+        }(std::make_index_sequence<std::extent_v<V>>{});
+    } else {
+        wire_pack_into(v, p);
+    }
+}
+
+/** @note bool dibaca sebagai byte != 0; bit_cast<bool> dari byte selain 0/1 adalah UB */
+template <endian_t E, typename V>
+inline void wire_get(const uint8_t* p, V& v) noexcept {
+    if constexpr (std::is_same_v<V, bool>) {
+        v = p[0] != 0;
+    } else if constexpr (byte_swap_scalar<V>) {
+        v = load_endian<E, V>(p);
+    } else if constexpr (std::is_bounded_array_v<V>) {
+        constexpr size_t step = wire_value_size<std::remove_extent_t<V>>();
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (wire_get<E>(p + I * step, v[I]), ...);
+        }(std::make_index_sequence<std::extent_v<V>>{});
+    } else {
+        wire_unpack_into(p, v);
+    }
+}
+
+template <typename T>
+inline void wire_pack_into(const T& v, uint8_t* p) noexcept {
+    [&]<typename... Fs, size_t... I>(wire_fields<Fs...>, std::index_sequence<I...>) {
+        (with_field<Fs::member>(v, [&](const auto& f) {
+            wire_put<Fs::endian>(p + wire_offsets<T>[I], f);
+        }), ...);
+    }(typename wire_layout<T>::wire_fields_type{},
+      std::make_index_sequence<wire_layout<T>::wire_fields_type::count>{});
+}
+
+template <typename T>
+inline void wire_unpack_into(const uint8_t* p, T& v) noexcept {
+    [&]<typename... Fs, size_t... I>(wire_fields<Fs...>, std::index_sequence<I...>) {
+        ([&] {
+            constexpr auto M = Fs::member;
+            if constexpr (field_aligned<M>) {
+                wire_get<Fs::endian>(p + wire_offsets<T>[I], v.*M);
+            } else {
+                member_value_t<M> tmp;
+                wire_get<Fs::endian>(p + wire_offsets<T>[I], tmp);
+                std::memcpy(reinterpret_cast<uint8_t*>(&v) + field_offset<M>, &tmp, sizeof(tmp));
+            }
+        }(), ...);
+    }(typename wire_layout<T>::wire_fields_type{},
+      std::make_index_sequence<wire_layout<T>::wire_fields_type::count>{});
+}
+
+} // namespace detail
+
+/**
+ * @brief Tulis v ke out dalam bentuk wire packed (wire_size<T> byte, unaligned)
+ *
+ * Satu store (+ bswap / movbe) per field scalar pada offset compile-time;
+ * tidak ada loop runtime maupun padding.
+ *
+ * @example
+ * ```cpp
+ * uint8_t buf[wire_size<header>];
+ * wire_pack(h, buf);
+ * header back = wire_unpack<header>(buf);
+ * wire_unpack(buf, back);                  // in-place, tanpa salinan
+ * ```
+ */
+template <wire_struct T>
+inline void wire_pack(const T& v, void* out) noexcept {
+    detail::wire_pack_into(v, static_cast<uint8_t*>(out));
+}
+
+/**
+ * @brief Baca bentuk wire packed ke out (wire_size<T> byte, unaligned)
+ * @note Hanya field di wire_layout<T> yang ditulis; padding tidak disentuh.
+ *       Untuk loop parsing lebih cepat dari versi return value, yang harus
+ *       me-nol-kan T lalu menyalinnya
+ */
+template <wire_struct T>
+inline void wire_unpack(const void* in, T& out) noexcept {
+    detail::wire_unpack_into(static_cast<const uint8_t*>(in), out);
+}
+
+/**
+ * @brief Baca T dari bentuk wire packed (wire_size<T> byte, unaligned)
+ * @note Padding dan field di luar wire_layout<T> bernilai nol (value-initialized)
+ */
+template <wire_struct T>
+requires std::is_default_constructible_v<T>
+[[nodiscard]] inline T wire_unpack(const void* in) noexcept {
+    T v{};
+    detail::wire_unpack_into(static_cast<const uint8_t*>(in), v);
+    return v;
+}
+
+} // namespace zuu
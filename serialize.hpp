@@ -0,0 +1,406 @@
+#pragma once
+
+/**
+ * @file serialize.hpp
+ * @brief Format biner kompak untuk generic + zero-copy reader
+ * @version 1.0.0
+ *
+ * Format satu record (little-endian):
+ * ```
+ * ┌──────────────────────┬──────────────────────────────┐
+ * │ tag (index_type, LE) │ payload: wire_payload_size<T>│
+ * └──────────────────────┴──────────────────────────────┘
+ * ```
+ * - Valueless: tag = npos, tanpa payload
+ * - Scalar (integral, enum, floating) di-encode little-endian
+ * - Struct dengan field_list<T> / wire_layout<T>: di-pack per field tanpa
+ *   padding (wire_pack, layout.hpp; default big-endian per field)
+ * - Blob byte (alignof 1, tanpa padding, mis. std::array<uint8_t, N>): apa adanya
+ * - Tipe lain ditolak saat compile (tidak ada layout native / padding di wire)
+ */
+
+#include "generic.hpp"
+#include "endian.hpp"
+#include "layout.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace zuu {
+
+namespace detail {
+
+/** @brief Tipe yang di-encode dengan byte order tetap */
+template <typename T>
+inline constexpr bool wire_scalar_v = (std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+    (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/** @brief Tipe tanpa byte order maupun padding: alignof 1, unique object representation */
+template <typename T>
+inline constexpr bool wire_blob_v = !wire_scalar_v<T> && alignof(T) == 1 &&
+    std::has_unique_object_representations_v<T>;
+
+/** @brief Alternatif yang punya bentuk wire host-independent */
+template <typename T>
+concept wire_encodable = wire_scalar_v<T> || wire_blob_v<T> ||
+    (wire_struct<T> && std::is_default_constructible_v<T>);
+
+/** @brief Ukuran payload T di wire */
+template <typename T>
+[[nodiscard]] consteval size_t wire_payload_size() noexcept {
+    if constexpr (wire_scalar_v<T> || wire_blob_v<T>) return sizeof(T);
+    else return wire_size<T>;
+}
+
+/** @brief Tulis T ke dst (little-endian untuk scalar, per field untuk struct) */
+template <wire_encodable T>
+inline void wire_store(uint8_t* dst, const T& value) noexcept {
+    if constexpr (wire_scalar_v<T>) {
+        zuu::store_le<T>(dst, value);
+    } else if constexpr (wire_blob_v<T>) {
+        std::memcpy(dst, &value, sizeof(T));
+    } else {
+        zuu::wire_pack(value, dst);
+    }
+}
+
+/**
+ * @brief Baca T dari src (unaligned; kebalikan wire_store)
+ * @note bool dibaca sebagai byte != 0: buffer tidak dipercaya, bit_cast<bool>
+ *       dari byte selain 0/1 adalah UB
+ */
+template <wire_encodable T>
+[[nodiscard]] inline T wire_load(const uint8_t* src) noexcept {
+    if constexpr (std::is_same_v<T, bool>) {
+        return src[0] != 0;
+    } else if constexpr (wire_scalar_v<T>) {
+        return zuu::load_le<T>(src);
+    } else if constexpr (wire_blob_v<T>) {
+        T value;
+        std::memcpy(&value, src, sizeof(T));
+        return value;
+    } else {
+        return zuu::wire_unpack<T>(src);
+    }
+}
+
+} // namespace detail
+
+// ============= Wire Format Info =============
+
+/**
+ * @brief Informasi compile-time format record untuk generic<Ts...>
+ */
+template <typename... Ts>
+struct wire_format {
+    static_assert((detail::wire_encodable<Ts> && ...),
+        "serialize: alternatif harus scalar, blob byte, atau struct dengan field_list / wire_layout");
+
+    using generic_t = generic<Ts...>;
+    using index_type = typename generic_t::index_type;
+    using list_t = typename generic_t::list_t;
+
+    static constexpr size_t type_count = sizeof...(Ts);
+    static constexpr index_type npos = generic_t::npos;
+
+    /** @brief Ukuran tag dalam bytes */
+    static constexpr size_t tag_size = sizeof(index_type);
+
+    /** @brief Ukuran payload per alternatif (struct: tanpa padding) */
+    static constexpr size_t payload_sizes[] = { detail::wire_payload_size<Ts>()... };
+
+    /** @brief Ukuran record terbesar */
+    static constexpr size_t max_record_size = tag_size + [] {
+        size_t m = 0;
+        for (size_t s : payload_sizes) m = s > m ? s : m;
+        return m;
+    }();
+
+    /** @brief Ukuran payload untuk tag (0 untuk valueless) */
+    [[nodiscard]] static constexpr size_t payload_size(size_t index) noexcept {
+        return index < type_count ? payload_sizes[index] : 0;
+    }
+
+    /** @brief Cek tag valid (alternatif atau npos) */
+    [[nodiscard]] static constexpr bool valid_tag(size_t index) noexcept {
+        return index < type_count || index == npos;
+    }
+
+    [[nodiscard]] static index_type load_tag(const uint8_t* src) noexcept {
+        return detail::wire_load<index_type>(src);
+    }
+
+    static void store_tag(uint8_t* dst, index_type index) noexcept {
+        detail::wire_store(dst, index);
+    }
+};
+
+// ============= Serialize =============
+
+/** @brief Ukuran record untuk g (tag + payload alternatif aktif) */
+template <typename... Ts>
+[[nodiscard]] constexpr size_t serialized_size(const generic<Ts...>& g) noexcept {
+    using fmt = wire_format<Ts...>;
+    return fmt::tag_size + fmt::payload_size(g.index());
+}
+
+/**
+ * @brief Tulis record ke out tanpa bounds check
+ * @param out Buffer minimal serialized_size(g) bytes
+ * @return Jumlah bytes yang ditulis
+ */
+template <typename... Ts>
+size_t serialize_unchecked(const generic<Ts...>& g, uint8_t* out) noexcept {
+    using fmt = wire_format<Ts...>;
+    fmt::store_tag(out, g.index());
+    g.visit_void([&](const auto& v) { detail::wire_store(out + fmt::tag_size, v); });
+    return serialized_size(g);
+}
+
+/**
+ * @brief Tulis record ke out
+ * @return Jumlah bytes yang ditulis, 0 jika out terlalu kecil
+ */
+template <typename... Ts>
+size_t serialize(const generic<Ts...>& g, std::span<uint8_t> out) noexcept {
+    if (out.size() < serialized_size(g)) return 0;
+    return serialize_unchecked(g, out.data());
+}
+
+/**
+ * @brief Append semua record dari range ke out
+ * @note Total ukuran dihitung dulu sehingga hanya ada satu resize
+ */
+template <typename Range>
+requires is_generic_v<std::ranges::range_value_t<Range>>
+void serialize_all(const Range& range, std::vector<uint8_t>& out) {
+    size_t total = 0;
+    for (const auto& g : range) total += serialized_size(g);
+
+    size_t pos = out.size();
+    out.resize(pos + total);
+    uint8_t* dst = out.data();
+    for (const auto& g : range) pos += serialize_unchecked(g, dst + pos);
+}
+
+/**
+ * @brief Baca satu record dari in
+ * @return Jumlah bytes yang dikonsumsi, 0 jika buffer terpotong atau tag invalid
+ */
+template <typename... Ts>
+size_t deserialize(std::span<const uint8_t> in, generic<Ts...>& out) noexcept {
+    using fmt = wire_format<Ts...>;
+    if (in.size() < fmt::tag_size) return 0;
+
+    const auto index = fmt::load_tag(in.data());
+    if (!fmt::valid_tag(index)) return 0;
+    const size_t size = fmt::tag_size + fmt::payload_size(index);
+    if (in.size() < size) return 0;
+
+    if (index == fmt::npos) {
+        out.reset();
+    } else {
+        auto invoke = [&](auto I) {
+            using T = typename fmt::list_t::template type<I>;
+            out = detail::wire_load<T>(in.data() + fmt::tag_size);
+        };
+        detail::dispatch<void, fmt::type_count, dispatch_t::automatic>(index, invoke);
+    }
+    return size;
+}
+
+// ============= Zero-copy Reader =============
+
+/**
+ * @brief View read-only atas buffer berisi record generic<Ts...> berurutan
+ *
+ * Tidak ada deserialisasi ke generic: tiap record dibaca langsung dari buffer,
+ * alternatif aktif di-load (unaligned) hanya saat diakses.
+ *
+ * @note Record berukuran variabel, iterasi hanya sequential (forward)
+ * @note Iterasi berhenti di record pertama yang terpotong atau tag invalid
+ *
+ * @example
+ * ```cpp
+ * serialized_view<int, double> view(buffer);
+ * for (auto rec : view) {
+ *     if (rec.holds<int>()) sum += rec.get<int>();
+ * }
+ * ```
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+class serialized_view {
+public:
+    using format = wire_format<Ts...>;
+    using generic_t = generic<Ts...>;
+    using index_type = typename format::index_type;
+    using list_t = typename format::list_t;
+
+    /** @brief Satu record dalam buffer */
+    class record {
+        const uint8_t* pos_ = nullptr;
+
+        friend class serialized_view;
+
+        explicit record(const uint8_t* pos) noexcept : pos_(pos) {}
+
+        template <typename T>
+        static constexpr index_type index_of_v = static_cast<index_type>(list_t::template index_of<T>);
+
+        [[nodiscard]] const uint8_t* payload() const noexcept { return pos_ + format::tag_size; }
+
+    public:
+        [[nodiscard]] index_type index() const noexcept { return format::load_tag(pos_); }
+        [[nodiscard]] bool has_value() const noexcept { return index() != format::npos; }
+
+        /** @brief Ukuran record dalam bytes */
+        [[nodiscard]] size_t size_bytes() const noexcept {
+            return format::tag_size + format::payload_size(index());
+        }
+
+        /** @brief Payload mentah alternatif aktif */
+        [[nodiscard]] std::span<const uint8_t> payload_bytes() const noexcept {
+            return { payload(), format::payload_size(index()) };
+        }
+
+        template <typename T>
+        requires (list_t::template contains<T>)
+        [[nodiscard]] bool holds() const noexcept { return index() == index_of_v<T>; }
+
+        /** @brief Load alternatif T (throws jika tipe salah) */
+        template <typename T>
+        requires (list_t::template contains<T>)
+        [[nodiscard]] T get() const {
+            if (index() != index_of_v<T>) throw std::bad_cast();
+            return detail::wire_load<T>(payload());
+        }
+
+        /** @brief Load tanpa check (UB jika salah) */
+        template <typename T>
+        requires (list_t::template contains<T>)
+        [[nodiscard]] T get_unchecked() const noexcept {
+            return detail::wire_load<T>(payload());
+        }
+
+        /** @brief Visit alternatif aktif (di-load by value) */
+        template <typename F>
+        [[nodiscard]] auto visit(F&& f) const {
+            using R = std::common_type_t<decltype(f(std::declval<const Ts&>()))...>;
+            auto invoke = [&](auto I) -> R {
+                using T = typename list_t::template type<I>;
+                const T value = detail::wire_load<T>(payload());
+                return std::forward<F>(f)(value);
+            };
+            return detail::dispatch<R, sizeof...(Ts), dispatch_t::automatic>(index(), invoke);
+        }
+
+        template <typename F>
+        void visit_void(F&& f) const {
+            auto invoke = [&](auto I) {
+                using T = typename list_t::template type<I>;
+                const T value = detail::wire_load<T>(payload());
+                std::forward<F>(f)(value);
+            };
+            detail::dispatch<void, sizeof...(Ts), dispatch_t::automatic>(index(), invoke);
+        }
+
+        /** @brief Materialize sebagai generic */
+        [[nodiscard]] generic_t to_generic() const noexcept {
+            generic_t g;
+            deserialize(std::span<const uint8_t>(pos_, size_bytes()), g);
+            return g;
+        }
+    };
+
+    /** @brief Forward iterator atas record */
+    class iterator {
+        const uint8_t* pos_ = nullptr;
+        const uint8_t* end_ = nullptr;
+
+        friend class serialized_view;
+
+        iterator(const uint8_t* pos, const uint8_t* end) noexcept : pos_(pos), end_(end) {
+            validate();
+        }
+
+        /** @brief Lompat ke end jika record di pos_ terpotong/invalid */
+        void validate() noexcept {
+            const size_t left = static_cast<size_t>(end_ - pos_);
+            if (left < format::tag_size) { pos_ = end_; return; }
+            const auto index = format::load_tag(pos_);
+            if (!format::valid_tag(index) ||
+                left < format::tag_size + format::payload_size(index)) {
+                pos_ = end_;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = record;
+        using difference_type = std::ptrdiff_t;
+        using reference = record;
+
+        iterator() noexcept = default;
+
+        [[nodiscard]] record operator*() const noexcept { return record(pos_); }
+
+        iterator& operator++() noexcept {
+            pos_ += record(pos_).size_bytes();
+            validate();
+            return *this;
+        }
+
+        iterator operator++(int) noexcept { auto t = *this; ++*this; return t; }
+
+        [[nodiscard]] bool operator==(const iterator& o) const noexcept { return pos_ == o.pos_; }
+
+        /** @brief Offset record dalam buffer */
+        [[nodiscard]] const uint8_t* position() const noexcept { return pos_; }
+    };
+
+private:
+    std::span<const uint8_t> buffer_;
+
+public:
+    constexpr serialized_view() noexcept = default;
+    constexpr explicit serialized_view(std::span<const uint8_t> buffer) noexcept : buffer_(buffer) {}
+
+    [[nodiscard]] iterator begin() const noexcept {
+        return iterator(buffer_.data(), buffer_.data() + buffer_.size());
+    }
+    [[nodiscard]] iterator end() const noexcept {
+        const uint8_t* e = buffer_.data() + buffer_.size();
+        iterator it;
+        it.pos_ = e;
+        it.end_ = e;
+        return it;
+    }
+
+    [[nodiscard]] std::span<const uint8_t> bytes() const noexcept { return buffer_; }
+    [[nodiscard]] bool empty() const noexcept { return buffer_.empty(); }
+
+    /** @brief Cek seluruh buffer terdiri dari record lengkap dan valid */
+    [[nodiscard]] bool valid() const noexcept {
+        size_t consumed = 0;
+        for (auto it = begin(); it != end(); ++it) consumed += (*it).size_bytes();
+        return consumed == buffer_.size();
+    }
+
+    /** @brief Jumlah record (scan linear) */
+    [[nodiscard]] size_t count() const noexcept {
+        size_t n = 0;
+        for (auto it = begin(); it != end(); ++it) ++n;
+        return n;
+    }
+};
+
+} // namespace zuu